@@ -122,6 +122,58 @@ typedef enum mfci_format_t {
    MFCI_FORMATS_COUNT      //!< Количество кадров МФЦИ
 } mfci_format_t;
 
+//! Маски кадров МФЦИ (mfci_format_t) для отбора входных подадресов, данные которых используются отображаемыми кадрами
+#define MFCI_FORMAT_BIT(format) (1ull << (format))                 //!< Признак кадра МФЦИ в маске кадров
+#define MFCI_FORMATS_ALL        ((1ull << MFCI_FORMATS_COUNT) - 1) //!< Все кадры МФЦИ (подадрес передается постоянно или использующий его кадр не определен)
+#define MFCI_FORMATS_NAV (MFCI_FORMAT_BIT(MFCI_FORMAT_KPI) | MFCI_FORMAT_BIT(MFCI_FORMAT_PNP) | MFCI_FORMAT_BIT(MFCI_FORMAT_PLAN) | MFCI_FORMAT_BIT(MFCI_FORMAT_KART) | MFCI_FORMAT_BIT(MFCI_FORMAT_KART_NSTR) | MFCI_FORMAT_BIT(MFCI_FORMAT_SUO) | MFCI_FORMAT_BIT(MFCI_FORMAT_SUO_IIPA))       //!< Кадры КПИ, ПНП, ПЛАН, КАРТ (с КАРТА:НСТР), СУО (с СУО-ИИПЭ)
+#define MFCI_FORMATS_DV  (MFCI_FORMAT_BIT(MFCI_FORMAT_DVS) | MFCI_FORMAT_BIT(MFCI_FORMAT_DV))                                                                                                                                                                                                    //!< Кадры ДВ/С, ДВ
+#define MFCI_FORMATS_SUO (MFCI_FORMAT_BIT(MFCI_FORMAT_SUO) | MFCI_FORMAT_BIT(MFCI_FORMAT_SUO_IIPA))                                                                                                                                                                                              //!< Кадры СУО, СУО-ИИПЭ
+#define MFCI_FORMATS_1HZ (MFCI_FORMAT_BIT(MFCI_FORMAT_SVR) | MFCI_FORMAT_BIT(MFCI_FORMAT_BASK) | MFCI_FORMAT_BIT(MFCI_FORMAT_MSRP) | MFCI_FORMAT_BIT(MFCI_FORMAT_BLOCKS) | MFCI_FORMAT_BIT(MFCI_FORMAT_BLOCKS_CRC) | MFCI_FORMAT_BIT(MFCI_FORMAT_BLOCKS_SZI) | MFCI_FORMAT_BIT(MFCI_FORMAT_TAR)) //!< Кадры СВР, БАСК, МСРП, БЛОКИ (с КС и СЗИ), ТАР
+
+//! Маски кадров МФЦИ, использующих входные подадреса 1-30 МКИО-3.1 (по таблице подадресов)
+#define MFCI_IN_SA_1_FORMATS  MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (сигнализация)
+#define MFCI_IN_SA_2_FORMATS  MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (сигнализация)
+#define MFCI_IN_SA_3_FORMATS  MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (сигнализация)
+#define MFCI_IN_SA_4_FORMATS  (MFCI_FORMATS_NAV | MFCI_FORMATS_DV | MFCI_FORMAT_BIT(MFCI_FORMAT_GRUP) | MFCI_FORMAT_BIT(MFCI_FORMAT_UPR))                                  //!< КПИ, ПНП, ПЛАН, КАРТ, СУО, ГРУП, ДВ/С, ДВ, УПР
+#define MFCI_IN_SA_5_FORMATS  (MFCI_FORMATS_DV | MFCI_FORMAT_BIT(MFCI_FORMAT_KPI))                                                                                         //!< ДВ/С, ДВ, КПИ
+#define MFCI_IN_SA_6_FORMATS  MFCI_FORMATS_DV                                                                                                                              //!< ДВ/С, ДВ
+#define MFCI_IN_SA_7_FORMATS  MFCI_FORMATS_DV                                                                                                                              //!< ДВ/С, ДВ
+#define MFCI_IN_SA_8_FORMATS  MFCI_FORMATS_DV                                                                                                                              //!< ДВ/С, ДВ
+#define MFCI_IN_SA_9_FORMATS  MFCI_FORMATS_DV                                                                                                                              //!< ДВ/С, ДВ
+#define MFCI_IN_SA_10_FORMATS (MFCI_FORMATS_NAV | MFCI_FORMATS_DV | MFCI_FORMAT_BIT(MFCI_FORMAT_GRUP))                                                                     //!< КПИ, ПНП, ПЛАН, КАРТ, СУО, ГРУП, ДВ/С, ДВ
+#define MFCI_IN_SA_11_FORMATS MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (ПУИ/МУП)
+#define MFCI_IN_SA_12_FORMATS (MFCI_FORMATS_NAV | MFCI_FORMAT_BIT(MFCI_FORMAT_UPR))                                                                                        //!< КПИ, ПНП, ПЛАН, КАРТ, СУО, УПР
+#define MFCI_IN_SA_13_FORMATS MFCI_FORMATS_NAV                                                                                                                             //!< КПИ, ПНП, ПЛАН, КАРТ, СУО
+#define MFCI_IN_SA_14_FORMATS (MFCI_FORMAT_BIT(MFCI_FORMAT_KPI) | MFCI_FORMAT_BIT(MFCI_FORMAT_PNP) | MFCI_FORMAT_BIT(MFCI_FORMAT_RLS) | MFCI_FORMAT_BIT(MFCI_FORMAT_GRUP)) //!< КПИ, ПНП, РЛС, ГРУП
+#define MFCI_IN_SA_15_FORMATS MFCI_FORMAT_BIT(MFCI_FORMAT_GRUP)                                                                                                            //!< ГРУП
+#define MFCI_IN_SA_16_FORMATS MFCI_FORMAT_BIT(MFCI_FORMAT_RAP)                                                                                                             //!< РЭП
+#define MFCI_IN_SA_17_FORMATS MFCI_FORMAT_BIT(MFCI_FORMAT_RAP)                                                                                                             //!< РЭП
+#define MFCI_IN_SA_18_FORMATS MFCI_FORMAT_BIT(MFCI_FORMAT_RAP)                                                                                                             //!< РЭП
+#define MFCI_IN_SA_19_FORMATS MFCI_FORMAT_BIT(MFCI_FORMAT_SAS)                                                                                                             //!< СЭС
+#define MFCI_IN_SA_20_FORMATS (MFCI_FORMAT_BIT(MFCI_FORMAT_SAS) | MFCI_FORMAT_BIT(MFCI_FORMAT_SKV))                                                                        //!< СЭС, СКВ
+#define MFCI_IN_SA_21_FORMATS (MFCI_FORMAT_BIT(MFCI_FORMAT_KPI) | MFCI_FORMAT_BIT(MFCI_FORMAT_UPR) | MFCI_FORMAT_BIT(MFCI_FORMAT_DVS) | MFCI_FORMAT_BIT(MFCI_FORMAT_TOPL)) //!< КПИ, УПР, ДВ/С, ТОПЛ
+#define MFCI_IN_SA_22_FORMATS (MFCI_FORMAT_BIT(MFCI_FORMAT_UPR) | MFCI_FORMAT_BIT(MFCI_FORMAT_TOPL))                                                                       //!< УПР, ТОПЛ
+#define MFCI_IN_SA_23_FORMATS (MFCI_FORMAT_BIT(MFCI_FORMAT_TOPL) | MFCI_FORMAT_BIT(MFCI_FORMAT_VSU))                                                                       //!< ТОПЛ, ВСУ
+#define MFCI_IN_SA_24_FORMATS (MFCI_FORMAT_BIT(MFCI_FORMAT_VSU) | MFCI_FORMAT_BIT(MFCI_FORMAT_SKV) | MFCI_FORMAT_BIT(MFCI_FORMAT_GS))                                      //!< ВСУ, СКВ, ГС
+#define MFCI_IN_SA_25_FORMATS MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (слова УПР)
+#define MFCI_IN_SA_26_FORMATS MFCI_FORMATS_1HZ                                                                                                                             //!< СВР/БАСК/МСРП/БЛОКИ/КС/СЗИ/ТАР (МСРП в таблице подадресов не указан, но mfci_in_msrp_1/2_b_t передаются в подадресах 26-27)
+#define MFCI_IN_SA_27_FORMATS MFCI_FORMATS_1HZ                                                                                                                             //!< СВР/БАСК/МСРП/БЛОКИ/КС/СЗИ/ТАР (МСРП в таблице подадресов не указан, но mfci_in_msrp_1/2_b_t передаются в подадресах 26-27)
+#define MFCI_IN_SA_28_FORMATS MFCI_FORMATS_1HZ                                                                                                                             //!< СВР/БАСК/МСРП/БЛОКИ/КС/СЗИ/ТАР (МСРП в таблице подадресов не указан, но mfci_in_msrp_1/2_b_t передаются в подадресах 26-27)
+#define MFCI_IN_SA_29_FORMATS MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (план полета)
+#define MFCI_IN_SA_30_FORMATS MFCI_FORMATS_ALL                                                                                                                             //!< передается постоянно (план полета)
+
+//! Маска кадров МФЦИ, использующих адресные подадреса 1-3 МКИО-3.1 (mfci_to_bgs_b_t: слова УПР всех МФЦИ и курсоры МУП, от кадра не зависят)
+#define MFCI_IN_ADDR_SA_1_3_FORMATS MFCI_FORMATS_ALL //!< 1 Гц, данные из МФЦИ в БГС
+
+//! Маски кадров МФЦИ, использующих входные подадреса МКИО-3.2 (по таблице подадресов)
+#define MFCI_IN_MKIO32_SA_1_20_FORMATS  MFCI_FORMATS_SUO                                                       //!< СУО (из ФПО БП)
+#define MFCI_IN_MKIO32_SA_21_23_FORMATS MFCI_FORMATS_SUO                                                       //!< СУО (из МФЦИ в БГС)
+#define MFCI_IN_MKIO32_SA_24_FORMATS    MFCI_FORMATS_ALL                                                       //!< ФОВБ (кадр в таблице подадресов не указан, поэтому подадрес декодируется при любом кадре)
+#define MFCI_IN_MKIO32_SA_25_FORMATS    MFCI_FORMAT_BIT(MFCI_FORMAT_BLOCKS_SZI)                                //!< СЗИ
+#define MFCI_IN_MKIO32_SA_26_FORMATS    MFCI_FORMAT_BIT(MFCI_FORMAT_SUO_IIPA)                                  //!< ИИПЭ
+#define MFCI_IN_MKIO32_SA_27_29_FORMATS MFCI_FORMAT_BIT(MFCI_FORMAT_ASU)                                       //!< АСУ
+#define MFCI_IN_MKIO32_SA_30_FORMATS    (MFCI_FORMAT_BIT(MFCI_FORMAT_ASU) | MFCI_FORMAT_BIT(MFCI_FORMAT_19DA)) //!< АСУ-МФПУ и 19ДА
+
 //! Масштаб МФЦИ
 typedef enum mfci_scale_t {
    MFCI_SCALE_20,    //!< Масштаб МФЦИ М:20 км
@@ -1386,6 +1438,1031 @@ typedef struct mfci_signals_word_54_b_t {
    uint16_t                            : 4; //!< Резерв
 } mfci_signals_word_54_b_t;
 
+//! Номера битов и маски признаков слов сигнализации МФЦИ для проверки признаков целым словом (порядок битов - от младшего)
+//! Определения ведутся вручную вместе со структурами mfci_signals_word_N_b_t: номер бита признака равен сумме ширин предшествующих полей структуры,
+//! маска слова MFCI_SIGNALS_WORD_N_MASK содержит все признаки, кроме резерва. При добавлении, удалении или перестановке признака в структуре
+//! соответствующие определения _BIT и маска слова изменяются в той же правке.
+#define MFCI_SIGNALS_WORDS_COUNT  54                                 //!< Количество слов сигнализации МФЦИ
+#define MFCI_SIGNALS_COUNT        (MFCI_SIGNALS_WORDS_COUNT * 16)    //!< Количество идентификаторов сигналов МФЦИ (с учетом резерва)
+#define MFCI_SIGNAL_MASK(bit)     ((uint16_t)(1u << (bit)))          //!< Маска признака слова сигнализации МФЦИ по номеру бита
+#define MFCI_SIGNAL_ID(word, bit) ((((word) - 1) * 16) + (bit))      //!< Идентификатор сигнала МФЦИ по номеру слова (1…54) и номеру бита
+#define MFCI_SIGNAL_ID_WORD(id)   (((id) / 16) + 1)                  //!< Номер слова сигнализации МФЦИ (1…54) по идентификатору сигнала
+#define MFCI_SIGNAL_ID_BIT(id)    ((id) % 16)                        //!< Номер бита слова сигнализации МФЦИ по идентификатору сигнала
+
+//! Признаки слова 1 сигнализации МФЦИ (mfci_signals_word_1_b_t)
+#define MFCI_SIGNALS_WORD_1_DV1_TURB_OVERHEATING_BIT 0      //!< [ДВ1-Д007] ДВ1 ОПОРА ПЕРЕГРЕВ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV2_TURB_OVERHEATING_BIT 1      //!< [ДВ2-Д007] ДВ2 ОПОРА ПЕРЕГРЕВ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV3_TURB_OVERHEATING_BIT 2      //!< [ДВ3-Д007] ДВ3 ОПОРА ПЕРЕГРЕВ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV4_TURB_OVERHEATING_BIT 3      //!< [ДВ4-Д007] ДВ4 ОПОРА ПЕРЕГРЕВ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV1_COOLING_FAILURE_BIT  4      //!< [ДВ1-Д008] ДВ1 ОХЛАЖД ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV2_COOLING_FAILURE_BIT  5      //!< [ДВ2-Д008] ДВ2 ОХЛАЖД ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV3_COOLING_FAILURE_BIT  6      //!< [ДВ3-Д008] ДВ3 ОХЛАЖД ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV4_COOLING_FAILURE_BIT  7      //!< [ДВ4-Д008] ДВ4 ОХЛАЖД ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV1_SWARF_BIT            8      //!< [ДВ1-Д015] ДВ1 СТРУЖКА В МАСЛЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV2_SWARF_BIT            9      //!< [ДВ2-Д015] ДВ2 СТРУЖКА В МАСЛЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV3_SWARF_BIT            10     //!< [ДВ3-Д015] ДВ3 СТРУЖКА В МАСЛЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV4_SWARF_BIT            11     //!< [ДВ4-Д015] ДВ4 СТРУЖКА В МАСЛЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV1_OIL_LOW_BIT          12     //!< [ДВ1-Д017] ДВ1 МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV2_OIL_LOW_BIT          13     //!< [ДВ2-Д017] ДВ2 МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV3_OIL_LOW_BIT          14     //!< [ДВ3-Д017] ДВ3 МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_DV4_OIL_LOW_BIT          15     //!< [ДВ4-Д017] ДВ4 МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_1_MASK                     0xffff //!< Маска признаков слова 1 сигнализации МФЦИ
+
+//! Признаки слова 2 сигнализации МФЦИ (mfci_signals_word_2_b_t)
+#define MFCI_SIGNALS_WORD_2_DV1_OIL_HIGH_BIT            0      //!< [ДВ1-Д018] ДВ1 МАСЛА МНОГО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV2_OIL_HIGH_BIT            1      //!< [ДВ2-Д018] ДВ2 МАСЛА МНОГО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV3_OIL_HIGH_BIT            2      //!< [ДВ3-Д018] ДВ3 МАСЛА МНОГО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV4_OIL_HIGH_BIT            3      //!< [ДВ4-Д018] ДВ4 МАСЛА МНОГО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV1_OIL_PRESSURE_IN_LOW_BIT 4      //!< [ДВ1-Д019] ДВ1 ДАВЛ МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV2_OIL_PRESSURE_IN_LOW_BIT 5      //!< [ДВ2-Д019] ДВ2 ДАВЛ МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV3_OIL_PRESSURE_IN_LOW_BIT 6      //!< [ДВ3-Д019] ДВ3 ДАВЛ МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV4_OIL_PRESSURE_IN_LOW_BIT 7      //!< [ДВ4-Д019] ДВ4 ДАВЛ МАСЛА МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV1_SURGE_BIT               8      //!< [ДВ1-Д020] ДВ1 ПОМПАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV2_SURGE_BIT               9      //!< [ДВ2-Д020] ДВ2 ПОМПАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV3_SURGE_BIT               10     //!< [ДВ3-Д020] ДВ3 ПОМПАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV4_SURGE_BIT               11     //!< [ДВ4-Д020] ДВ4 ПОМПАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV1_FUEL_PRESSURE_LOW_BIT   12     //!< [ДВ1-Д021] ДВ1 ДАВЛ ТОПЛ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV2_FUEL_PRESSURE_LOW_BIT   13     //!< [ДВ2-Д021] ДВ2 ДАВЛ ТОПЛ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV3_FUEL_PRESSURE_LOW_BIT   14     //!< [ДВ3-Д021] ДВ3 ДАВЛ ТОПЛ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_DV4_FUEL_PRESSURE_LOW_BIT   15     //!< [ДВ4-Д021] ДВ4 ДАВЛ ТОПЛ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_2_MASK                        0xffff //!< Маска признаков слова 2 сигнализации МФЦИ
+
+//! Признаки слова 3 сигнализации МФЦИ (mfci_signals_word_3_b_t)
+#define MFCI_SIGNALS_WORD_3_DV1_ESUD_HEALTHY_BIT   0      //!< [ДВ1-Д023] ДВ1 ЭСУД ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV2_ESUD_HEALTHY_BIT   1      //!< [ДВ2-Д023] ДВ2 ЭСУД ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV3_ESUD_HEALTHY_BIT   2      //!< [ДВ3-Д023] ДВ3 ЭСУД ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV4_ESUD_HEALTHY_BIT   3      //!< [ДВ4-Д023] ДВ4 ЭСУД ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV1_CLOGGING_BIT       4      //!< [ДВ1-Д028] ДВ1 ТОПЛ ФИЛЬТР ЗАСОРЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV2_CLOGGING_BIT       5      //!< [ДВ2-Д028] ДВ2 ТОПЛ ФИЛЬТР ЗАСОРЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV3_CLOGGING_BIT       6      //!< [ДВ3-Д028] ДВ3 ТОПЛ ФИЛЬТР ЗАСОРЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV4_CLOGGING_BIT       7      //!< [ДВ4-Д028] ДВ4 ТОПЛ ФИЛЬТР ЗАСОРЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV1_OIL_TEMP_HIGH_BIT  8      //!< [ДВ1-Д029] ДВ1 ТЕМПЕР МАСЛА ВХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV2_OIL_TEMP_HIGH_BIT  9      //!< [ДВ2-Д029] ДВ2 ТЕМПЕР МАСЛА ВХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV3_OIL_TEMP_HIGH_BIT  10     //!< [ДВ3-Д029] ДВ3 ТЕМПЕР МАСЛА ВХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV4_OIL_TEMP_HIGH_BIT  11     //!< [ДВ4-Д029] ДВ4 ТЕМПЕР МАСЛА ВХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV1_VIBRATION_HIGH_BIT 12     //!< [ДВ1-Д030] ДВ1 ВИБР ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV2_VIBRATION_HIGH_BIT 13     //!< [ДВ2-Д030] ДВ2 ВИБР ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV3_VIBRATION_HIGH_BIT 14     //!< [ДВ3-Д030] ДВ3 ВИБР ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_DV4_VIBRATION_HIGH_BIT 15     //!< [ДВ4-Д030] ДВ4 ВИБР ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_3_MASK                   0xffff //!< Маска признаков слова 3 сигнализации МФЦИ
+
+//! Признаки слова 4 сигнализации МФЦИ (mfci_signals_word_4_b_t)
+#define MFCI_SIGNALS_WORD_4_DV1_VNA_FAILURE_BIT              0      //!< [ДВ1-Д031] ДВ1 ОБОГРЕВ ВНА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV2_VNA_FAILURE_BIT              1      //!< [ДВ2-Д031] ДВ2 ОБОГРЕВ ВНА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV3_VNA_FAILURE_BIT              2      //!< [ДВ3-Д031] ДВ3 ОБОГРЕВ ВНА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV4_VNA_FAILURE_BIT              3      //!< [ДВ4-Д031] ДВ4 ОБОГРЕВ ВНА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV1_BEARING_TEMPERATURE_HIGH_BIT 4      //!< [ДВ1-Д032] ДВ1 ТЕМПЕР ПОДШ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV2_BEARING_TEMPERATURE_HIGH_BIT 5      //!< [ДВ2-Д032] ДВ2 ТЕМПЕР ПОДШ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV3_BEARING_TEMPERATURE_HIGH_BIT 6      //!< [ДВ3-Д032] ДВ3 ТЕМПЕР ПОДШ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV4_BEARING_TEMPERATURE_HIGH_BIT 7      //!< [ДВ4-Д032] ДВ4 ТЕМПЕР ПОДШ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV1_NO_CORRECTION_BIT            8      //!< [ДВ1-Д033] ДВ1 НЕТ КОРРЕКЦИИ ОТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV2_NO_CORRECTION_BIT            9      //!< [ДВ2-Д033] ДВ2 НЕТ КОРРЕКЦИИ ОТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV3_NO_CORRECTION_BIT            10     //!< [ДВ3-Д033] ДВ3 НЕТ КОРРЕКЦИИ ОТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV4_NO_CORRECTION_BIT            11     //!< [ДВ4-Д033] ДВ4 НЕТ КОРРЕКЦИИ ОТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV1_INTAKE_HEALTHY_BIT           12     //!< [ДВ1-Д034] ДВ1 АУ ВЗ ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV2_INTAKE_HEALTHY_BIT           13     //!< [ДВ2-Д034] ДВ2 АУ ВЗ ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV3_INTAKE_HEALTHY_BIT           14     //!< [ДВ3-Д034] ДВ3 АУ ВЗ ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_DV4_INTAKE_HEALTHY_BIT           15     //!< [ДВ4-Д034] ДВ4 АУ ВЗ ИСПРАВНА (ДВ/С)
+#define MFCI_SIGNALS_WORD_4_MASK                             0xffff //!< Маска признаков слова 4 сигнализации МФЦИ
+
+//! Признаки слова 5 сигнализации МФЦИ (mfci_signals_word_5_b_t)
+#define MFCI_SIGNALS_WORD_5_DV1_INTAKE_TEST_BIT           0      //!< [ДВ1-Д035] ДВ1 АУ ВЗ КОНТРОЛЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV2_INTAKE_TEST_BIT           1      //!< [ДВ2-Д035] ДВ2 АУ ВЗ КОНТРОЛЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV3_INTAKE_TEST_BIT           2      //!< [ДВ3-Д035] ДВ3 АУ ВЗ КОНТРОЛЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV4_INTAKE_TEST_BIT           3      //!< [ДВ4-Д035] ДВ4 АУ ВЗ КОНТРОЛЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV1_THROTTLE_AFTERBURNING_BIT 4      //!< [ДВ1-Д036] ДВ1 ДРОССЕЛИР С ФОРСАЖЕМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV2_THROTTLE_AFTERBURNING_BIT 5      //!< [ДВ2-Д036] ДВ2 ДРОССЕЛИР С ФОРСАЖЕМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV3_THROTTLE_AFTERBURNING_BIT 6      //!< [ДВ3-Д036] ДВ3 ДРОССЕЛИР С ФОРСАЖЕМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV4_THROTTLE_AFTERBURNING_BIT 7      //!< [ДВ4-Д036] ДВ4 ДРОССЕЛИР С ФОРСАЖЕМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV1_TURN_OFF_BIT              8      //!< [ДВ1-Д037] ДВ1 ВЫКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV2_TURN_OFF_BIT              9      //!< [ДВ2-Д037] ДВ2 ВЫКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV3_TURN_OFF_BIT              10     //!< [ДВ3-Д037] ДВ3 ВЫКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV4_TURN_OFF_BIT              11     //!< [ДВ4-Д037] ДВ4 ВЫКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV1_INTAKE_FAILURE_BIT        12     //!< [ДВ1-Д039] ДВ1 АУ ВЗ НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV2_INTAKE_FAILURE_BIT        13     //!< [ДВ2-Д039] ДВ2 АУ ВЗ НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV3_INTAKE_FAILURE_BIT        14     //!< [ДВ3-Д039] ДВ3 АУ ВЗ НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_DV4_INTAKE_FAILURE_BIT        15     //!< [ДВ4-Д039] ДВ4 АУ ВЗ НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_5_MASK                          0xffff //!< Маска признаков слова 5 сигнализации МФЦИ
+
+//! Признаки слова 6 сигнализации МФЦИ (mfci_signals_word_6_b_t)
+#define MFCI_SIGNALS_WORD_6_DV1_WEDGE_FAILURE_BIT            0      //!< [ДВ1-Д040] ДВ1 АУ КЛИНОМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV2_WEDGE_FAILURE_BIT            1      //!< [ДВ2-Д040] ДВ2 АУ КЛИНОМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV3_WEDGE_FAILURE_BIT            2      //!< [ДВ3-Д040] ДВ3 АУ КЛИНОМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV4_WEDGE_FAILURE_BIT            3      //!< [ДВ4-Д040] ДВ4 АУ КЛИНОМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV1_VALVE_FAILURE_BIT            4      //!< [ДВ1-Д041] ДВ1 АУ СТВОРОК ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV2_VALVE_FAILURE_BIT            5      //!< [ДВ2-Д041] ДВ2 АУ СТВОРОК ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV3_VALVE_FAILURE_BIT            6      //!< [ДВ3-Д041] ДВ3 АУ СТВОРОК ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV4_VALVE_FAILURE_BIT            7      //!< [ДВ4-Д041] ДВ4 АУ СТВОРОК ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV1_N_SD_HIGH_BIT                8      //!< [ДВ1-Д042] ДВ1 ОБОРОТЫ СД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV2_N_SD_HIGH_BIT                9      //!< [ДВ2-Д042] ДВ2 ОБОРОТЫ СД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV3_N_SD_HIGH_BIT                10     //!< [ДВ3-Д042] ДВ3 ОБОРОТЫ СД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV4_N_SD_HIGH_BIT                11     //!< [ДВ4-Д042] ДВ4 ОБОРОТЫ СД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV1_OIL_TEMPERATURE_OUT_HIGH_BIT 12     //!< [ДВ1-Д044] ДВ1 ТЕМПЕР МАСЛА ВЫХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV2_OIL_TEMPERATURE_OUT_HIGH_BIT 13     //!< [ДВ2-Д044] ДВ2 ТЕМПЕР МАСЛА ВЫХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV3_OIL_TEMPERATURE_OUT_HIGH_BIT 14     //!< [ДВ3-Д044] ДВ3 ТЕМПЕР МАСЛА ВЫХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_DV4_OIL_TEMPERATURE_OUT_HIGH_BIT 15     //!< [ДВ4-Д044] ДВ4 ТЕМПЕР МАСЛА ВЫХОДА ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_6_MASK                             0xffff //!< Маска признаков слова 6 сигнализации МФЦИ
+
+//! Признаки слова 7 сигнализации МФЦИ (mfci_signals_word_7_b_t)
+#define MFCI_SIGNALS_WORD_7_DV1_NO_AFTERBURNING_BIT       0      //!< [ДВ1-Д045] ДВ1 НЕТ ФОРСАЖА/ ПОВТОРИ ФОРСАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV2_NO_AFTERBURNING_BIT       1      //!< [ДВ2-Д045] ДВ2 НЕТ ФОРСАЖА/ ПОВТОРИ ФОРСАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV3_NO_AFTERBURNING_BIT       2      //!< [ДВ3-Д045] ДВ3 НЕТ ФОРСАЖА/ ПОВТОРИ ФОРСАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV4_NO_AFTERBURNING_BIT       3      //!< [ДВ4-Д045] ДВ4 НЕТ ФОРСАЖА/ ПОВТОРИ ФОРСАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV1_OIL_PRESSURE_GP22_LOW_BIT 4      //!< [ДВ1-Д046] ДВ1 ДАВЛ МАСЛА ГП МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV2_OIL_PRESSURE_GP22_LOW_BIT 5      //!< [ДВ2-Д046] ДВ2 ДАВЛ МАСЛА ГП МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV3_OIL_PRESSURE_GP22_LOW_BIT 6      //!< [ДВ3-Д046] ДВ3 ДАВЛ МАСЛА ГП МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV4_OIL_PRESSURE_GP22_LOW_BIT 7      //!< [ДВ4-Д046] ДВ4 ДАВЛ МАСЛА ГП МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV1_HYDRAULIC_LOCK_BIT        8      //!< [ДВ1-Д047] ДВ1 ГИДРОУПОР ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV2_HYDRAULIC_LOCK_BIT        9      //!< [ДВ2-Д047] ДВ2 ГИДРОУПОР ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV3_HYDRAULIC_LOCK_BIT        10     //!< [ДВ3-Д047] ДВ3 ГИДРОУПОР ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV4_HYDRAULIC_LOCK_BIT        11     //!< [ДВ4-Д047] ДВ4 ГИДРОУПОР ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV1_OIL_PRESSURE_GSBK_LOW_BIT 12     //!< [ДВ1-Д049] ДВ1 ДАВЛ МАСЛА ГСБК МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV2_OIL_PRESSURE_GSBK_LOW_BIT 13     //!< [ДВ2-Д049] ДВ2 ДАВЛ МАСЛА ГСБК МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV3_OIL_PRESSURE_GSBK_LOW_BIT 14     //!< [ДВ3-Д049] ДВ3 ДАВЛ МАСЛА ГСБК МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_DV4_OIL_PRESSURE_GSBK_LOW_BIT 15     //!< [ДВ4-Д049] ДВ4 ДАВЛ МАСЛА ГСБК МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_7_MASK                          0xffff //!< Маска признаков слова 7 сигнализации МФЦИ
+
+//! Признаки слова 8 сигнализации МФЦИ (mfci_signals_word_8_b_t)
+#define MFCI_SIGNALS_WORD_8_DV1_FUEL_TEMPERATURE_TMT_HIGH_BIT 0      //!< [ДВ1-Д055] ДВ1 ТЕМПЕР ТОПЛ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV2_FUEL_TEMPERATURE_TMT_HIGH_BIT 1      //!< [ДВ2-Д055] ДВ2 ТЕМПЕР ТОПЛ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV3_FUEL_TEMPERATURE_TMT_HIGH_BIT 2      //!< [ДВ3-Д055] ДВ3 ТЕМПЕР ТОПЛ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV4_FUEL_TEMPERATURE_TMT_HIGH_BIT 3      //!< [ДВ4-Д055] ДВ4 ТЕМПЕР ТОПЛ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV1_STARTER_HIGH_BIT              4      //!< [ДВ1-Д056] ДВ1 ОБОРОТЫ СТАРТЕРА ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV2_STARTER_HIGH_BIT              5      //!< [ДВ2-Д056] ДВ2 ОБОРОТЫ СТАРТЕРА ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV3_STARTER_HIGH_BIT              6      //!< [ДВ3-Д056] ДВ3 ОБОРОТЫ СТАРТЕРА ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV4_STARTER_HIGH_BIT              7      //!< [ДВ4-Д056] ДВ4 ОБОРОТЫ СТАРТЕРА ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV1_VPT_PRESSURE_LOW_BIT          8      //!< [ДВ1-Д057] ДВ1 ДАВЛ ВПТ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV2_VPT_PRESSURE_LOW_BIT          9      //!< [ДВ2-Д057] ДВ2 ДАВЛ ВПТ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV3_VPT_PRESSURE_LOW_BIT          10     //!< [ДВ3-Д057] ДВ3 ДАВЛ ВПТ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV4_VPT_PRESSURE_LOW_BIT          11     //!< [ДВ4-Д057] ДВ4 ДАВЛ ВПТ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV1_BREATHER_PRESSURE_HIGH_BIT    12     //!< [ДВ1-Д058] ДВ1 ДАВЛ СУФЛИР ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV2_BREATHER_PRESSURE_HIGH_BIT    13     //!< [ДВ2-Д058] ДВ2 ДАВЛ СУФЛИР ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV3_BREATHER_PRESSURE_HIGH_BIT    14     //!< [ДВ3-Д058] ДВ3 ДАВЛ СУФЛИР ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_DV4_BREATHER_PRESSURE_HIGH_BIT    15     //!< [ДВ4-Д058] ДВ4 ДАВЛ СУФЛИР ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_8_MASK                              0xffff //!< Маска признаков слова 8 сигнализации МФЦИ
+
+//! Признаки слова 9 сигнализации МФЦИ (mfci_signals_word_9_b_t)
+#define MFCI_SIGNALS_WORD_9_DV1_START_FAILURE_ON_LAND_BIT    0      //!< [ДВ1-Д061] ДВ1 ЭСУД НЕИСПР (ЗАП ЗЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV2_START_FAILURE_ON_LAND_BIT    1      //!< [ДВ2-Д061] ДВ2 ЭСУД НЕИСПР (ЗАП ЗЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV3_START_FAILURE_ON_LAND_BIT    2      //!< [ДВ3-Д061] ДВ3 ЭСУД НЕИСПР (ЗАП ЗЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV4_START_FAILURE_ON_LAND_BIT    3      //!< [ДВ4-Д061] ДВ4 ЭСУД НЕИСПР (ЗАП ЗЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV1_START_FAILURE_IN_AIR_BIT     4      //!< [ДВ1-Д062] ДВ1 ЭСУД НЕИСПР (ЗАП ВОЗД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV2_START_FAILURE_IN_AIR_BIT     5      //!< [ДВ2-Д062] ДВ2 ЭСУД НЕИСПР (ЗАП ВОЗД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV3_START_FAILURE_IN_AIR_BIT     6      //!< [ДВ3-Д062] ДВ3 ЭСУД НЕИСПР (ЗАП ВОЗД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV4_START_FAILURE_IN_AIR_BIT     7      //!< [ДВ4-Д062] ДВ4 ЭСУД НЕИСПР (ЗАП ВОЗД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV1_GAS_TEMP_CONTROL_FAILURE_BIT 8      //!< [ДВ1-Д063] ДВ1 ЭСУД НЕИСПР (ОГРАН ТГ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV2_GAS_TEMP_CONTROL_FAILURE_BIT 9      //!< [ДВ2-Д063] ДВ2 ЭСУД НЕИСПР (ОГРАН ТГ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV3_GAS_TEMP_CONTROL_FAILURE_BIT 10     //!< [ДВ3-Д063] ДВ3 ЭСУД НЕИСПР (ОГРАН ТГ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV4_GAS_TEMP_CONTROL_FAILURE_BIT 11     //!< [ДВ4-Д063] ДВ4 ЭСУД НЕИСПР (ОГРАН ТГ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV1_N2_CONTROL_FAILURE_BIT       12     //!< [ДВ1-Д064] ДВ1 ЭСУД НЕИСПР (ОГРАН ВД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV2_N2_CONTROL_FAILURE_BIT       13     //!< [ДВ2-Д064] ДВ2 ЭСУД НЕИСПР (ОГРАН ВД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV3_N2_CONTROL_FAILURE_BIT       14     //!< [ДВ3-Д064] ДВ3 ЭСУД НЕИСПР (ОГРАН ВД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_DV4_N2_CONTROL_FAILURE_BIT       15     //!< [ДВ4-Д064] ДВ4 ЭСУД НЕИСПР (ОГРАН ВД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_9_MASK                             0xffff //!< Маска признаков слова 9 сигнализации МФЦИ
+
+//! Признаки слова 10 сигнализации МФЦИ (mfci_signals_word_10_b_t)
+#define MFCI_SIGNALS_WORD_10_DV1_N1_CONTROL_FAILURE_BIT           0      //!< [ДВ1-Д065] ДВ1 ЭСУД НЕИСПР (УПРАВЛ НД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV2_N1_CONTROL_FAILURE_BIT           1      //!< [ДВ2-Д065] ДВ2 ЭСУД НЕИСПР (УПРАВЛ НД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV3_N1_CONTROL_FAILURE_BIT           2      //!< [ДВ3-Д065] ДВ3 ЭСУД НЕИСПР (УПРАВЛ НД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV4_N1_CONTROL_FAILURE_BIT           3      //!< [ДВ4-Д065] ДВ4 ЭСУД НЕИСПР (УПРАВЛ НД ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV1_AFTERBURNING_CONTROL_FAILURE_BIT 4      //!< [ДВ1-Д066] ДВ1 ЭСУД НЕИСПР (УПР ФОРСАЖЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV2_AFTERBURNING_CONTROL_FAILURE_BIT 5      //!< [ДВ2-Д066] ДВ2 ЭСУД НЕИСПР (УПР ФОРСАЖЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV3_AFTERBURNING_CONTROL_FAILURE_BIT 6      //!< [ДВ3-Д066] ДВ3 ЭСУД НЕИСПР (УПР ФОРСАЖЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV4_AFTERBURNING_CONTROL_FAILURE_BIT 7      //!< [ДВ4-Д066] ДВ4 ЭСУД НЕИСПР (УПР ФОРСАЖЕМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV1_ANTISURGE_CONTROL_FAILURE_BIT    8      //!< [ДВ1-Д067] ДВ1 ЭСУД НЕИСПР (ППЗ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV2_ANTISURGE_CONTROL_FAILURE_BIT    9      //!< [ДВ2-Д067] ДВ2 ЭСУД НЕИСПР (ППЗ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV3_ANTISURGE_CONTROL_FAILURE_BIT    10     //!< [ДВ3-Д067] ДВ3 ЭСУД НЕИСПР (ППЗ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV4_ANTISURGE_CONTROL_FAILURE_BIT    11     //!< [ДВ4-Д067] ДВ4 ЭСУД НЕИСПР (ППЗ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV1_COOLING_CONTROL_FAILURE_BIT      12     //!< [ДВ1-Д068] ДВ1 УПР ОХЛ ТУРБИНЫ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV2_COOLING_CONTROL_FAILURE_BIT      13     //!< [ДВ2-Д068] ДВ2 УПР ОХЛ ТУРБИНЫ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV3_COOLING_CONTROL_FAILURE_BIT      14     //!< [ДВ3-Д068] ДВ3 УПР ОХЛ ТУРБИНЫ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_10_DV4_COOLING_CONTROL_FAILURE_BIT      15     //!< [ДВ4-Д068] ДВ4 УПР ОХЛ ТУРБИНЫ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_10_MASK                                 0xffff //!< Маска признаков слова 10 сигнализации МФЦИ
+
+//! Признаки слова 11 сигнализации МФЦИ (mfci_signals_word_11_b_t)
+#define MFCI_SIGNALS_WORD_11_DV1_LOCK_CONTROL_FAILURE_BIT       0      //!< [ДВ1-Д069] ДВ1 ЭСУД НЕИСПР (УПР ГИДРОУПОР ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV2_LOCK_CONTROL_FAILURE_BIT       1      //!< [ДВ2-Д069] ДВ2 ЭСУД НЕИСПР (УПР ГИДРОУПОР ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV3_LOCK_CONTROL_FAILURE_BIT       2      //!< [ДВ3-Д069] ДВ3 ЭСУД НЕИСПР (УПР ГИДРОУПОР ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV4_LOCK_CONTROL_FAILURE_BIT       3      //!< [ДВ4-Д069] ДВ4 ЭСУД НЕИСПР (УПР ГИДРОУПОР ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV1_KPV_CONTROL_FAILURE_BIT        4      //!< [ДВ1-Д070] ДВ1 УПР КПВ СД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV2_KPV_CONTROL_FAILURE_BIT        5      //!< [ДВ2-Д070] ДВ2 УПР КПВ СД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV3_KPV_CONTROL_FAILURE_BIT        6      //!< [ДВ3-Д070] ДВ3 УПР КПВ СД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV4_KPV_CONTROL_FAILURE_BIT        7      //!< [ДВ4-Д070] ДВ4 УПР КПВ СД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV1_NOZZLE_CONTROL_FAILURE_BIT     8      //!< [ДВ1-Д071] ДВ1 ЭСУД НЕИСПР (УПР СОПЛОМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV2_NOZZLE_CONTROL_FAILURE_BIT     9      //!< [ДВ2-Д071] ДВ2 ЭСУД НЕИСПР (УПР СОПЛОМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV3_NOZZLE_CONTROL_FAILURE_BIT     10     //!< [ДВ3-Д071] ДВ3 ЭСУД НЕИСПР (УПР СОПЛОМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV4_NOZZLE_CONTROL_FAILURE_BIT     11     //!< [ДВ4-Д071] ДВ4 ЭСУД НЕИСПР (УПР СОПЛОМ ОТКАЗ, СОСТ)
+#define MFCI_SIGNALS_WORD_11_DV1_START_FAILED_MAIN_SWITCHER_BIT 12     //!< [ДВ1-Д072] ДВ1 ЗАПУСК ПРЕКРАЩЕН (НЕТ ГЛАВНЫЙ ВЫКЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_11_DV2_START_FAILED_MAIN_SWITCHER_BIT 13     //!< [ДВ2-Д072] ДВ2 ЗАПУСК ПРЕКРАЩЕН (НЕТ ГЛАВНЫЙ ВЫКЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_11_DV3_START_FAILED_MAIN_SWITCHER_BIT 14     //!< [ДВ3-Д072] ДВ3 ЗАПУСК ПРЕКРАЩЕН (НЕТ ГЛАВНЫЙ ВЫКЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_11_DV4_START_FAILED_MAIN_SWITCHER_BIT 15     //!< [ДВ4-Д072] ДВ4 ЗАПУСК ПРЕКРАЩЕН (НЕТ ГЛАВНЫЙ ВЫКЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_11_MASK                               0xffff //!< Маска признаков слова 11 сигнализации МФЦИ
+
+//! Признаки слова 12 сигнализации МФЦИ (mfci_signals_word_12_b_t)
+#define MFCI_SIGNALS_WORD_12_DV1_START_FAILED_STARTER_BIT       0      //!< [ДВ1-Д073] ДВ1 ЗАПУСК ПРЕКРАЩЕН (ОБОРОТЫ СТАРТЕРА ПРЕДЕЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV2_START_FAILED_STARTER_BIT       1      //!< [ДВ2-Д073] ДВ2 ЗАПУСК ПРЕКРАЩЕН (ОБОРОТЫ СТАРТЕРА ПРЕДЕЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV3_START_FAILED_STARTER_BIT       2      //!< [ДВ3-Д073] ДВ3 ЗАПУСК ПРЕКРАЩЕН (ОБОРОТЫ СТАРТЕРА ПРЕДЕЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV4_START_FAILED_STARTER_BIT       3      //!< [ДВ4-Д073] ДВ4 ЗАПУСК ПРЕКРАЩЕН (ОБОРОТЫ СТАРТЕРА ПРЕДЕЛ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV1_START_FAILED_STOP_SWITCHER_BIT 4      //!< [ДВ1-Д074] ДВ1 ЗАПУСК ПРЕКРАЩЕН (СТОП-КРАН НЕ ОТКРЫТ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV2_START_FAILED_STOP_SWITCHER_BIT 5      //!< [ДВ2-Д074] ДВ2 ЗАПУСК ПРЕКРАЩЕН (СТОП-КРАН НЕ ОТКРЫТ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV3_START_FAILED_STOP_SWITCHER_BIT 6      //!< [ДВ3-Д074] ДВ3 ЗАПУСК ПРЕКРАЩЕН (СТОП-КРАН НЕ ОТКРЫТ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV4_START_FAILED_STOP_SWITCHER_BIT 7      //!< [ДВ4-Д074] ДВ4 ЗАПУСК ПРЕКРАЩЕН (СТОП-КРАН НЕ ОТКРЫТ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV1_START_FAILED_KPV_BIT           8      //!< [ДВ1-Д075] ДВ1 ЗАПУСК ПРЕКРАЩЕН (КПВ ВД НЕ ОТКР, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV2_START_FAILED_KPV_BIT           9      //!< [ДВ2-Д075] ДВ2 ЗАПУСК ПРЕКРАЩЕН (КПВ ВД НЕ ОТКР, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV3_START_FAILED_KPV_BIT           10     //!< [ДВ3-Д075] ДВ3 ЗАПУСК ПРЕКРАЩЕН (КПВ ВД НЕ ОТКР, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV4_START_FAILED_KPV_BIT           11     //!< [ДВ4-Д075] ДВ4 ЗАПУСК ПРЕКРАЩЕН (КПВ ВД НЕ ОТКР, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV1_START_FAILED_SUPPLY_115_BIT    12     //!< [ДВ1-Д076] ДВ1 ЗАПУСК ПРЕКРАЩЕН (115В НЕ В НОРМЕ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV2_START_FAILED_SUPPLY_115_BIT    13     //!< [ДВ2-Д076] ДВ2 ЗАПУСК ПРЕКРАЩЕН (115В НЕ В НОРМЕ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV3_START_FAILED_SUPPLY_115_BIT    14     //!< [ДВ3-Д076] ДВ3 ЗАПУСК ПРЕКРАЩЕН (115В НЕ В НОРМЕ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_DV4_START_FAILED_SUPPLY_115_BIT    15     //!< [ДВ4-Д076] ДВ4 ЗАПУСК ПРЕКРАЩЕН (115В НЕ В НОРМЕ, ДВ/С)
+#define MFCI_SIGNALS_WORD_12_MASK                               0xffff //!< Маска признаков слова 12 сигнализации МФЦИ
+
+//! Признаки слова 13 сигнализации МФЦИ (mfci_signals_word_13_b_t)
+#define MFCI_SIGNALS_WORD_13_DV1_START_FAILED_CONTROL_BIT  0      //!< [ДВ1-Д077] ДВ1 ЗАПУСК ПРЕКРАЩЕН (ЭСУД ОТКАЗ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV2_START_FAILED_CONTROL_BIT  1      //!< [ДВ2-Д077] ДВ2 ЗАПУСК ПРЕКРАЩЕН (ЭСУД ОТКАЗ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV3_START_FAILED_CONTROL_BIT  2      //!< [ДВ3-Д077] ДВ3 ЗАПУСК ПРЕКРАЩЕН (ЭСУД ОТКАЗ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV4_START_FAILED_CONTROL_BIT  3      //!< [ДВ4-Д077] ДВ4 ЗАПУСК ПРЕКРАЩЕН (ЭСУД ОТКАЗ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV1_START_FAILED_SPINUP_BIT   4      //!< [ДВ1-Д078] ДВ1 ЗАПУСК ПРЕКРАЩЕН (НЕТ РАСКРУТКИ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV2_START_FAILED_SPINUP_BIT   5      //!< [ДВ2-Д078] ДВ2 ЗАПУСК ПРЕКРАЩЕН (НЕТ РАСКРУТКИ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV3_START_FAILED_SPINUP_BIT   6      //!< [ДВ3-Д078] ДВ3 ЗАПУСК ПРЕКРАЩЕН (НЕТ РАСКРУТКИ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV4_START_FAILED_SPINUP_BIT   7      //!< [ДВ4-Д078] ДВ4 ЗАПУСК ПРЕКРАЩЕН (НЕТ РАСКРУТКИ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV1_START_FAILED_GAS_TEMP_BIT 8      //!< [ДВ1-Д079] ДВ1 ЗАПУСК ПРЕКРАЩЕН (ТЕМПЕР ГАЗА ОПАСНАЯ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV2_START_FAILED_GAS_TEMP_BIT 9      //!< [ДВ2-Д079] ДВ2 ЗАПУСК ПРЕКРАЩЕН (ТЕМПЕР ГАЗА ОПАСНАЯ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV3_START_FAILED_GAS_TEMP_BIT 10     //!< [ДВ3-Д079] ДВ3 ЗАПУСК ПРЕКРАЩЕН (ТЕМПЕР ГАЗА ОПАСНАЯ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV4_START_FAILED_GAS_TEMP_BIT 11     //!< [ДВ4-Д079] ДВ4 ЗАПУСК ПРЕКРАЩЕН (ТЕМПЕР ГАЗА ОПАСНАЯ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV1_START_FAILED_HANDUP_BIT   12     //!< [ДВ1-Д080] ДВ1 ЗАПУСК ПРЕКРАЩЕН (ВРЕМЯ ЗАП ПРЕВЫШ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV2_START_FAILED_HANDUP_BIT   13     //!< [ДВ2-Д080] ДВ2 ЗАПУСК ПРЕКРАЩЕН (ВРЕМЯ ЗАП ПРЕВЫШ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV3_START_FAILED_HANDUP_BIT   14     //!< [ДВ3-Д080] ДВ3 ЗАПУСК ПРЕКРАЩЕН (ВРЕМЯ ЗАП ПРЕВЫШ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_DV4_START_FAILED_HANDUP_BIT   15     //!< [ДВ4-Д080] ДВ4 ЗАПУСК ПРЕКРАЩЕН (ВРЕМЯ ЗАП ПРЕВЫШ, ДВ/С)
+#define MFCI_SIGNALS_WORD_13_MASK                          0xffff //!< Маска признаков слова 13 сигнализации МФЦИ
+
+//! Признаки слова 14 сигнализации МФЦИ (mfci_signals_word_14_b_t)
+#define MFCI_SIGNALS_WORD_14_DV1_START_FAILED_IGNITION_BIT 0      //!< [ДВ1-Д081] ДВ1 ЗАПУСК ПРЕКРАЩЕН (НЕТ РОЗЖИГА, ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV2_START_FAILED_IGNITION_BIT 1      //!< [ДВ2-Д081] ДВ2 ЗАПУСК ПРЕКРАЩЕН (НЕТ РОЗЖИГА, ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV3_START_FAILED_IGNITION_BIT 2      //!< [ДВ3-Д081] ДВ3 ЗАПУСК ПРЕКРАЩЕН (НЕТ РОЗЖИГА, ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV4_START_FAILED_IGNITION_BIT 3      //!< [ДВ4-Д081] ДВ4 ЗАПУСК ПРЕКРАЩЕН (НЕТ РОЗЖИГА, ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV1_KPV_UNDEFINED_BIT         4      //!< [ДВ1-Л001] ДВ1 КОМПРЕСС ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV2_KPV_UNDEFINED_BIT         5      //!< [ДВ2-Л001] ДВ2 КОМПРЕСС ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV3_KPV_UNDEFINED_BIT         6      //!< [ДВ3-Л001] ДВ3 КОМПРЕСС ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV4_KPV_UNDEFINED_BIT         7      //!< [ДВ4-Л001] ДВ4 КОМПРЕСС ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV1_ESUD_FAILURE_BIT          8      //!< [ДВ1-Л002] ДВ1 ЭСУД НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV2_ESUD_FAILURE_BIT          9      //!< [ДВ2-Л002] ДВ2 ЭСУД НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV3_ESUD_FAILURE_BIT          10     //!< [ДВ3-Л002] ДВ3 ЭСУД НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV4_ESUD_FAILURE_BIT          11     //!< [ДВ4-Л002] ДВ4 ЭСУД НЕИСПР (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV1_GAS_TEMP_HIGH_DANGER_BIT  12     //!< [ДВ1-Л003] ДВ1 ТЕМПЕР ГАЗА ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV2_GAS_TEMP_HIGH_DANGER_BIT  13     //!< [ДВ2-Л003] ДВ2 ТЕМПЕР ГАЗА ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV3_GAS_TEMP_HIGH_DANGER_BIT  14     //!< [ДВ3-Л003] ДВ3 ТЕМПЕР ГАЗА ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_DV4_GAS_TEMP_HIGH_DANGER_BIT  15     //!< [ДВ4-Л003] ДВ4 ТЕМПЕР ГАЗА ОПАСНАЯ (ДВ/С)
+#define MFCI_SIGNALS_WORD_14_MASK                          0xffff //!< Маска признаков слова 14 сигнализации МФЦИ
+
+//! Признаки слова 15 сигнализации МФЦИ (mfci_signals_word_15_b_t)
+#define MFCI_SIGNALS_WORD_15_DV1_N1_HIGH_BIT          0      //!< [ДВ1-Л004] ДВ1 ОБОРОТЫ НД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV2_N1_HIGH_BIT          1      //!< [ДВ2-Л004] ДВ2 ОБОРОТЫ НД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV3_N1_HIGH_BIT          2      //!< [ДВ3-Л004] ДВ3 ОБОРОТЫ НД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV4_N1_HIGH_BIT          3      //!< [ДВ4-Л004] ДВ4 ОБОРОТЫ НД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV1_N2_HIGH_BIT          4      //!< [ДВ1-Л005] ДВ1 ОБОРОТЫ ВД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV2_N2_HIGH_BIT          5      //!< [ДВ2-Л005] ДВ2 ОБОРОТЫ ВД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV3_N2_HIGH_BIT          6      //!< [ДВ3-Л005] ДВ3 ОБОРОТЫ ВД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV4_N2_HIGH_BIT          7      //!< [ДВ4-Л005] ДВ4 ОБОРОТЫ ВД ОПАСНЫЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV1_RESERVE_CONTROLS_BIT 8      //!< [ДВ1-Л006] ДВ1 ПЕРЕХОД НА РА (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV2_RESERVE_CONTROLS_BIT 9      //!< [ДВ2-Л006] ДВ2 ПЕРЕХОД НА РА (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV3_RESERVE_CONTROLS_BIT 10     //!< [ДВ3-Л006] ДВ3 ПЕРЕХОД НА РА (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV4_RESERVE_CONTROLS_BIT 11     //!< [ДВ4-Л006] ДВ4 ПЕРЕХОД НА РА (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV1_GAS_TEMP_HIGH_BIT    12     //!< [ДВ1-Л007] ДВ1 ТЕМПЕР ГАЗА ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV2_GAS_TEMP_HIGH_BIT    13     //!< [ДВ2-Л007] ДВ2 ТЕМПЕР ГАЗА ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV3_GAS_TEMP_HIGH_BIT    14     //!< [ДВ3-Л007] ДВ3 ТЕМПЕР ГАЗА ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_DV4_GAS_TEMP_HIGH_BIT    15     //!< [ДВ4-Л007] ДВ4 ТЕМПЕР ГАЗА ПОВЫШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_15_MASK                     0xffff //!< Маска признаков слова 15 сигнализации МФЦИ
+
+//! Признаки слова 16 сигнализации МФЦИ (mfci_signals_word_16_b_t)
+#define MFCI_SIGNALS_WORD_16_DV1_ESUD_UNTESTED_BIT   0      //!< [ДВ1-Л008] ДВ1 ЭСУД ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV2_ESUD_UNTESTED_BIT   1      //!< [ДВ2-Л008] ДВ2 ЭСУД ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV3_ESUD_UNTESTED_BIT   2      //!< [ДВ3-Л008] ДВ3 ЭСУД ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV4_ESUD_UNTESTED_BIT   3      //!< [ДВ4-Л008] ДВ4 ЭСУД ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV1_INTAKE_UNTESTED_BIT 4      //!< [ДВ1-Л009] ДВ1 АУ ВЗ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV2_INTAKE_UNTESTED_BIT 5      //!< [ДВ2-Л009] ДВ2 АУ ВЗ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV3_INTAKE_UNTESTED_BIT 6      //!< [ДВ3-Л009] ДВ3 АУ ВЗ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV4_INTAKE_UNTESTED_BIT 7      //!< [ДВ4-Л009] ДВ4 АУ ВЗ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_DV1_DV_ACTIVE_BIT       8      //!< [ДВ1-Д027] Двигатель работает
+#define MFCI_SIGNALS_WORD_16_DV2_DV_ACTIVE_BIT       9      //!< [ДВ2-Д027] Двигатель работает
+#define MFCI_SIGNALS_WORD_16_DV3_DV_ACTIVE_BIT       10     //!< [ДВ3-Д027] Двигатель работает
+#define MFCI_SIGNALS_WORD_16_DV4_DV_ACTIVE_BIT       11     //!< [ДВ4-Д027] Двигатель работает
+#define MFCI_SIGNALS_WORD_16_TOPL_DZ_ON_BIT          12     //!< [ТОПЛ-Д001] ТОПЛ АВТ ЗАПРАВКИ ВКЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_TOPL_DZ_FAILURE_BIT     13     //!< [ТОПЛ-Д002] ТОПЛ АВТ ЗАПРАВКИ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_TOPL_FAILURE_LEFT_BIT   14     //!< [ТОПЛ-Д003] ТОПЛ ИЗМЕР ЛЕВ БОРТА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_TOPL_FAILURE_RIGHT_BIT  15     //!< [ТОПЛ-Д004] ТОПЛ ИЗМЕР ПРАВ БОРТА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_16_MASK                    0xffff //!< Маска признаков слова 16 сигнализации МФЦИ
+
+//! Признаки слова 17 сигнализации МФЦИ (mfci_signals_word_17_b_t)
+#define MFCI_SIGNALS_WORD_17_DZ_LOCK_BIT               0      //!< [ТОПЛ-Д005] ДОЗАПРАВКА СЦЕПКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_DISCHARGE_FRONT_BIT  1      //!< [ТОПЛ-Д006] ТОПЛ СЛИВ АВАР ПЕРЕДН БАКОВ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_DISCHARGE_REAR_BIT   2      //!< [ТОПЛ-Д007] ТОПЛ СЛИВ АВАР ЗАДН БАКОВ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B1L_FAILURE_BIT 3      //!< [ТОПЛ-Д256] ТОПЛ НАСОСЫ Б1Л ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B1R_FAILURE_BIT 4      //!< [ТОПЛ-Д257] ТОПЛ НАСОСЫ Б1П ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B2L_FAILURE_BIT 5      //!< [ТОПЛ-Д258] ТОПЛ НАСОСЫ Б2Л ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B2R_FAILURE_BIT 6      //!< [ТОПЛ-Д259] ТОПЛ НАСОСЫ Б2П ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B3L_FAILURE_BIT 7      //!< [ТОПЛ-Д260] ТОПЛ НАСОСЫ Б3Л ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B3R_FAILURE_BIT 8      //!< [ТОПЛ-Д261] ТОПЛ НАСОСЫ Б3П ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B4L_FAILURE_BIT 9      //!< [ТОПЛ-Д262] ТОПЛ НАСОСЫ Б4Л ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B4R_FAILURE_BIT 10     //!< [ТОПЛ-Д263] ТОПЛ НАСОСЫ Б4П ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B5_FAILURE_BIT  11     //!< [ТОПЛ-Д264] ТОПЛ НАСОСЫ Б5 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_B6_FAILURE_BIT  12     //!< [ТОПЛ-Д265] ТОПЛ НАСОСЫ Б6 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_RB1_FAILURE_BIT 13     //!< [ТОПЛ-Д266] ТОПЛ НАСОСЫ РБ1 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_RB2_FAILURE_BIT 14     //!< [ТОПЛ-Д267] ТОПЛ НАСОСЫ РБ2 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_TOPL_PUMP_RB3_FAILURE_BIT 15     //!< [ТОПЛ-Д268] ТОПЛ НАСОСЫ РБ3 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_17_MASK                      0xffff //!< Маска признаков слова 17 сигнализации МФЦИ
+
+//! Признаки слова 18 сигнализации МФЦИ (mfci_signals_word_18_b_t)
+#define MFCI_SIGNALS_WORD_18_TOPL_PUMP_RB4_FAILURE_BIT         0      //!< [ТОПЛ-Д269] ТОПЛ НАСОСЫ РБ4 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_PUMP_B1L_BALANCE_FAILURE_BIT 1      //!< [ТОПЛ-Д270] ТОПЛ БАЛАНС НАСОСЫ Б1Л ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_PUMP_B1R_BALANCE_FAILURE_BIT 2      //!< [ТОПЛ-Д271] ТОПЛ БАЛАНС НАСОСЫ Б1П ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_PUMP_B5_BALANCE_FAILURE_BIT  3      //!< [ТОПЛ-Д272] ТОПЛ БАЛАНС НАСОСЫ Б5 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_PUMP_B6_BALANCE_FAILURE_BIT  4      //!< [ТОПЛ-Д273] ТОПЛ БАЛАНС НАСОСЫ Б6 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_CENTERING_FAILURE_BIT        5      //!< [ТОПЛ-Д274] ТОПЛ АВТ ЦЕНТРОВКИ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_CONSUMP_FAILURE_BIT          6      //!< [ТОПЛ-Д275] ТОПЛ АВТ РАСХОДА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_DZ_SUPPLY_ON_BIT                  7      //!< [ТОПЛ-Д276] Включение питания щитка дозаправки
+#define MFCI_SIGNALS_WORD_18_FORCE_FUELING_BIT                 8      //!< [ТОПЛ-Д285] Принудительная заправка
+#define MFCI_SIGNALS_WORD_18_DZ_VALVE_BIT                      9      //!< [ТОПЛ-Д287] КЛАПАН ШТАНГИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_DZ_VALVE_OPENED_BIT               10     //!< [ТОПЛ-Д288] КЛАПАН ОТКРЫТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_CENTERING_REAR_LIM_BIT       11     //!< [ТОПЛ-Д291] ТОПЛ ЦЕНТРОВКА ЗАДН ПРЕДЕЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_CENTERING_FRONT_LIM_BIT      12     //!< [ТОПЛ-Д292] ТОПЛ ЦЕНТРОВКА ПЕРЕДН ПРЕДЕЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_VENTING_ON_BIT               13     //!< [ТОПЛ-Д293] ТОПЛ НАСОС ДРЕНАЖА ВКЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_VENTING_ACTIVE_BIT           14     //!< [ТОПЛ-Д294] ТОПЛ ДРЕНАЖ В БАКЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_TOPL_12T_BIT                      15     //!< [ТОПЛ-Л002] ТОПЛ ОСТАТОК 12 Т (ДВ/С)
+#define MFCI_SIGNALS_WORD_18_MASK                              0xffff //!< Маска признаков слова 18 сигнализации МФЦИ
+
+//! Признаки слова 19 сигнализации МФЦИ (mfci_signals_word_19_b_t)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB1_PUMP1_FAIL_BIT      0      //!< [ТОПЛ-Л_Н1РБ1_ОТКАЗ] ТОПЛ НАСОС 1 РБ1 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB1_PUMP2_FAIL_BIT      1      //!< [ТОПЛ-Л_Н2РБ1_ОТКАЗ] ТОПЛ НАСОС 2 РБ1 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB1_PUMP3_FAIL_BIT      2      //!< [ТОПЛ-Л_Н3РБ1_ОТКАЗ] ТОПЛ НАСОС 3 РБ1 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB2_PUMP1_FAIL_BIT      3      //!< [ТОПЛ-Л_Н1РБ2_ОТКАЗ] ТОПЛ НАСОС 1 РБ2 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB2_PUMP2_FAIL_BIT      4      //!< [ТОПЛ-Л_Н2РБ2_ОТКАЗ] ТОПЛ НАСОС 2 РБ2 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB2_PUMP3_FAIL_BIT      5      //!< [ТОПЛ-Л_Н3РБ2_ОТКАЗ] ТОПЛ НАСОС 3 РБ2 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB3_PUMP1_FAIL_BIT      6      //!< [ТОПЛ-Л_Н1РБ3_ОТКАЗ] ТОПЛ НАСОС 1 РБ3 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB3_PUMP2_FAIL_BIT      7      //!< [ТОПЛ-Л_Н2РБ3_ОТКАЗ] ТОПЛ НАСОС 2 РБ3 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB3_PUMP3_FAIL_BIT      8      //!< [ТОПЛ-Л_Н3РБ3_ОТКАЗ] ТОПЛ НАСОС 3 РБ3 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB4_PUMP1_FAIL_BIT      9      //!< [ТОПЛ-Л_Н1РБ4_ОТКАЗ] ТОПЛ НАСОС 1 РБ4 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB4_PUMP2_FAIL_BIT      10     //!< [ТОПЛ-Л_Н2РБ4_ОТКАЗ] ТОПЛ НАСОС 2 РБ4 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_RB4_PUMP3_FAIL_BIT      11     //!< [ТОПЛ-Л_Н3РБ4_ОТКАЗ] ТОПЛ НАСОС 3 РБ4 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_19_TOPL_VALVE_PK1_CLOSED_KV_BIT 12     //!< [ТОПЛ-Д141] КВ ЗАКР пожарного крана ПК1 (для счетчика давления азота)
+#define MFCI_SIGNALS_WORD_19_TOPL_VALVE_PK2_CLOSED_KV_BIT 13     //!< [ТОПЛ-Д145] КВ ЗАКР пожарного крана ПК2 (для счетчика давления азота)
+#define MFCI_SIGNALS_WORD_19_TOPL_VALVE_PK3_CLOSED_KV_BIT 14     //!< [ТОПЛ-Д149] КВ ЗАКР пожарного крана ПК3 (для счетчика давления азота)
+#define MFCI_SIGNALS_WORD_19_TOPL_VALVE_PK4_CLOSED_KV_BIT 15     //!< [ТОПЛ-Д153] КВ ЗАКР пожарного крана ПК4 (для счетчика давления азота)
+#define MFCI_SIGNALS_WORD_19_MASK                         0xffff //!< Маска признаков слова 19 сигнализации МФЦИ
+
+//! Признаки слова 20 сигнализации МФЦИ (mfci_signals_word_20_b_t)
+#define MFCI_SIGNALS_WORD_20_TOPL_CHECK_RB1_BIT  0      //!< [ТОПЛ-Д277] Проверь топливо РБ1 (положение РУД>72° нежелательно, для шкал двигателей)
+#define MFCI_SIGNALS_WORD_20_TOPL_CHECK_RB2_BIT  1      //!< [ТОПЛ-Д278] Проверь топливо РБ2 (положение РУД>72° нежелательно, для шкал двигателей)
+#define MFCI_SIGNALS_WORD_20_TOPL_CHECK_RB3_BIT  2      //!< [ТОПЛ-Д279] Проверь топливо РБ3 (положение РУД>72° нежелательно, для шкал двигателей)
+#define MFCI_SIGNALS_WORD_20_TOPL_CHECK_RB4_BIT  3      //!< [ТОПЛ-Д280] Проверь топливо РБ4 (положение РУД>72° нежелательно, для шкал двигателей)
+#define MFCI_SIGNALS_WORD_20_TOPL_CHECK_BIT      4      //!< [ТОПЛ-Л001] ТОПЛ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_20_SPEED_HIGH_BIT      5      //!< [ПКР-Д001] СКОРОСТЬ ВЕЛИКА (ДВ/С)
+#define MFCI_SIGNALS_WORD_20_SPEED_LOW_BIT       6      //!< [ПКР-Д002] СКОРОСТЬ МАЛА (ДВ/С)
+#define MFCI_SIGNALS_WORD_20_NY_HIGH_BIT         7      //!< [ПКР-Д003] Ny ПРЕДЕЛ (перегрузка выше максимальной, ДВ/С)
+#define MFCI_SIGNALS_WORD_20_NY_LOW_BIT          8      //!< [ПКР-Д004] Ny ПРЕДЕЛ (перегрузка ниже минимальной, ДВ/С)
+#define MFCI_SIGNALS_WORD_20_ROLL_LEFT_HIGH_BIT  9      //!< [ПКР-Д005] КРЕН ВЕЛИК (левый, ДВ/С)
+#define MFCI_SIGNALS_WORD_20_ROLL_RIGHT_HIGH_BIT 10     //!< [ПКР-Д006] КРЕН ВЕЛИК (правый, ДВ/С)
+#define MFCI_SIGNALS_WORD_20_ALPHA_HIGH_BIT      11     //!< [ПКР-Д007] АЛЬФА ПРЕДЕЛ (угол атаки выше максимального, ДВ/С)
+#define MFCI_SIGNALS_WORD_20_ALPHA_LOW_BIT       12     //!< [ПКР-Д008] АЛЬФА ПРЕДЕЛ (угол атаки ниже минимального, ДВ/С)
+#define MFCI_SIGNALS_WORD_20_ALTITUDE_APPR_1_BIT 13     //!< [ПКР-Д009] ЭШЕЛОН ПОДХОД (ДВ/С)
+#define MFCI_SIGNALS_WORD_20_ALTITUDE_APPR_2_BIT 14     //!< [ПКР-Д012] ЗАДАННАЯ ВЫСОТА ПОДХОД (ДВ/С)
+#define MFCI_SIGNALS_WORD_20_PKR_FAILURE_BIT     15     //!< [ПКР-Д017] ФУНКЦИИ ПКР ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_20_MASK                0xffff //!< Маска признаков слова 20 сигнализации МФЦИ
+
+//! Признаки слова 21 сигнализации МФЦИ (mfci_signals_word_21_b_t)
+#define MFCI_SIGNALS_WORD_21_PKR_ALPHA_OFF_BIT       0      //!< [ПКР-Д018] ПКР НЕТ КОНТРОЛЯ УГЛА АТАКИ (СОСТ)
+#define MFCI_SIGNALS_WORD_21_PKR_SPEED_MIN_OFF_BIT   1      //!< [ПКР-Д019] ПКР НЕТ КОНТРОЛЯ СКОРОСТИ МИН (СОСТ)
+#define MFCI_SIGNALS_WORD_21_PKR_SPEED_MAX_OFF_BIT   2      //!< [ПКР-Д020] ПКР НЕТ КОНТРОЛЯ СКОРОСТИ МАКС (СОСТ)
+#define MFCI_SIGNALS_WORD_21_PKR_NY_OFF_BIT          3      //!< [ПКР-Д021] ПКР НЕТ КОНТРОЛЯ ПЕРЕГРУЗКИ (СОСТ)
+#define MFCI_SIGNALS_WORD_21_PKR_ROLL_OFF_BIT        4      //!< [ПКР-Д022] ПКР НЕТ КОНТРОЛЯ КРЕНА (СОСТ)
+#define MFCI_SIGNALS_WORD_21_PKR_ALTITUDE_OFF_1_BIT  5      //!< [ПКР-Д023] ПКР НЕТ КОНТРОЛЯ ЗАДАННОГО ЭШЕЛОНА (СОСТ)
+#define MFCI_SIGNALS_WORD_21_PKR_ALTITUDE_OFF_2_BIT  6      //!< [ПКР-Д024] ПКР НЕТ КОНТРОЛЯ ЗАДАННОЙ ВЫСОТЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_21_CHECK_ALTITUDE_BIT      7      //!< [ПКР-Л001] ЭШЕЛОН ВЫСОТУ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_AP_FAILURE_BIT          8      //!< [САУ-Д022] АП ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_AZP_FAILURE_BIT         9      //!< [САУ-Д023] АЗП ЗАПРЕЩЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_AP_OFF_BIT              10     //!< [САУ-Д024] АП ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_AP_MODE_CHANGED_BIT     11     //!< [САУ-Д025] АП РЕЖИМ ИЗМЕНЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_AT_CONTROL_BIT          12     //!< [САУ-Д026] ТЯГОЙ УПРАВЛЯЙ (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_LANDING_CATHEGORY_1_BIT 13     //!< [САУ-Д042] КАТЕГОР ПОСАД1 (СОСТ)
+#define MFCI_SIGNALS_WORD_21_LANDING_CATHEGORY_2_BIT 14     //!< [САУ-Д043] КАТЕГОР ПОСАД2 (СОСТ)
+#define MFCI_SIGNALS_WORD_21_SAU_MANUAL_BIT          15     //!< [САУ] ПЕРЕЙДИ НА ШТУРВАЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_21_MASK                    0xffff //!< Маска признаков слова 21 сигнализации МФЦИ
+
+//! Признаки слова 22 сигнализации МФЦИ (mfci_signals_word_22_b_t)
+#define MFCI_SIGNALS_WORD_22_UNLOCK_RUD_BIT               0      //!< [САУ] РУД РАССТОПОРИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_DV1_AT_OFF_BIT               1      //!< [САУ] ДВ1 АТ ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_DV2_AT_OFF_BIT               2      //!< [САУ] ДВ2 АТ ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_DV3_AT_OFF_BIT               3      //!< [САУ] ДВ3 АТ ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_DV4_AT_OFF_BIT               4      //!< [САУ] ДВ4 АТ ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_DZ_PITCH_BIT                 5      //!< [АБСУ-Д024] УПОР ДЗ ТАНГАЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_ASSU_PITCH_FAILURE_BIT       6      //!< [АБСУ-Л019] АСШУ ТАНГАЖ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_ASSU_INTERC_FAILURE_BIT      7      //!< [АБСУ-Л020] ИНТЕРЦ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_ASSU_FIN_FAILURE_BIT         8      //!< [АБСУ-Л021] КИЛЬ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_22_ABSU_DMP_PITCH_FAILURE_BIT   9      //!< [АБСУ-Д037] АБСУ ДЕМПФЕР ТАНГАЖА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_22_ABSU_DMP_ROLL_FAILURE_BIT    10     //!< [АБСУ-Д038] АБСУ ДЕМПФЕР КРЕНА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_22_ABSU_DMP_HEADING_FAILURE_BIT 11     //!< [АБСУ-Д039] АБСУ ДЕМПФЕР КУРСА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_22_ABSU_NY_INVALID_BIT          12     //!< [АБСУ-Д040] АБСУ ОГРАНИЧЕНИЕ ПО ny ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_22_ABSU_ROLL_INVALID_BIT        13     //!< [АБСУ-Д041] АБСУ ОГРАНИЧЕНИЕ КРЕНА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_22_ABSU_STAB_OFF_BIT            14     //!< [АБСУ-Д042] АБСУ СТАБ ОТКЛЮЧЕН (СОСТ)
+#define MFCI_SIGNALS_WORD_22_ABSU_FIN_OFF_BIT             15     //!< [АБСУ-Д043] АБСУ КИЛЬ ОТКЛЮЧЕН (СОСТ)
+#define MFCI_SIGNALS_WORD_22_MASK                         0xffff //!< Маска признаков слова 22 сигнализации МФЦИ
+
+//! Признаки слова 23 сигнализации МФЦИ (mfci_signals_word_23_b_t)
+#define MFCI_SIGNALS_WORD_23_ABSU_INTERC_OFF_BIT           0      //!< [АБСУ-Д044] АБСУ ИНТЕРЦ ОТКЛЮЧЕНЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_ABSU_FLAPERON_OFF_BIT         1      //!< [АБСУ-Д045] АБСУ ФЛАП ОТКЛЮЧЕНЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_DMP_RA_OFF_1_BIT              2      //!< [АБСУ-Д046] АБСУ ДЕМПФЕР РА 1К ОТКЛЮЧЕНЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_DMP_RA_OFF_2_BIT              3      //!< [АБСУ-Д047] АБСУ ДЕМПФЕР РА 2К ОТКЛЮЧЕНЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_DMP_RA_OFF_3_BIT              4      //!< [АБСУ-Д048] АБСУ ДЕМПФЕР РА 3К ОТКЛЮЧЕНЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_DMP_RA_OFF_4_BIT              5      //!< [АБСУ-Д049] АБСУ ДЕМПФЕР РА 4К ОТКЛЮЧЕНЫ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_DAU_LEFT_HEATING_FAILURE_BIT  6      //!< [АБСУ-Д050] ДАУ ЛЕВ ОБОГРЕВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_DAU_RIGHT_HEATING_FAILURE_BIT 7      //!< [АБСУ-Д051] ДАУ ПРАВ ОБОГРЕВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_MB_PITCH1_FAILURE_BIT         8      //!< [АБСУ-Д052] АБСУ МБ ТАНГ КАН 1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_MB_PITCH2_FAILURE_BIT         9      //!< [АБСУ-Д053] АБСУ МБ ТАНГ КАН 2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_MR3_1_FAILURE_BIT             10     //!< [АБСУ-Д056] АБСУ МРЗ КАН 1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_MR3_2_FAILURE_BIT             11     //!< [АБСУ-Д057] АБСУ МРЗ КАН 2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_ASSU_FLAPERON_FAILURE_BIT     12     //!< [АБСУ-Л022] АСШУ ФЛАП ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_23_INTERC_BIT                    13     //!< [АБСУ-Д065] ИНТРЦ ВЫПУЩЕНЫ (НЕ ГОТОВ К ВЗЛЁТУ)
+#define MFCI_SIGNALS_WORD_23_ABSU_WEIGHT_FAILURE_BIT       14     //!< [АБСУ-Д066] АБСУ НЕТ ДАННЫХ ПО ВЕСУ (СОСТ)
+#define MFCI_SIGNALS_WORD_23_ABSU_VSP_FAILURE_BIT          15     //!< [АБСУ-Д067] АБСУ НЕТ ДАННЫХ ПО ВСП (СОСТ)
+#define MFCI_SIGNALS_WORD_23_MASK                          0xffff //!< Маска признаков слова 23 сигнализации МФЦИ
+
+//! Признаки слова 24 сигнализации МФЦИ (mfci_signals_word_24_b_t)
+#define MFCI_SIGNALS_WORD_24_ABSU_FLAP_FAILURE_BIT          0      //!< [АБСУ-Д068] АБСУ НЕТ ДАННЫХ ПО ЗАКРЫЛКАМ (СОСТ)
+#define MFCI_SIGNALS_WORD_24_ABSU_CHI_FAILURE_BIT           1      //!< [АБСУ-Д069] АБСУ НЕТ ДАННЫХ ПО СТРЕЛОВИДНОСТИ (СОСТ)
+#define MFCI_SIGNALS_WORD_24_ABSU_ALPHA_FAILURE_BIT         2      //!< [АБСУ-Д070] АБСУ НЕТ ДАННЫХ ПО УГЛУ АТАКИ (СОСТ)
+#define MFCI_SIGNALS_WORD_24_TRIMMER_ROLL_FAILURE_BIT       3      //!< [АБСУ-Д071] ТРИММЕР КРЕНА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_TRIMMER_COURSE_FAILURE_BIT     4      //!< [АБСУ-Д072] ТРИММЕР КУРСА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_TRIMMER_PITCH_FAILURE_BIT      5      //!< [АБСУ-Д073] ТРИММЕР ТАНГАЖА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_NX_FAILURE_BIT            6      //!< [АБСУ-Д078] АБСУ ОГРАНИЧЕНИЕ ПО Nх ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_24_ABSU_STAB_NO_RESERVE_BIT       7      //!< [АБСУ-Л001] РА СТАБ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_FIN_NO_RESERVE_BIT        8      //!< [АБСУ-Л002] РА КИЛЬ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_FLAPERON_L_NO_RESERVE_BIT 9      //!< [АБСУ-Л003] РА ФЛАП ЛЕВ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_FLAPERON_R_NO_RESERVE_BIT 10     //!< [АБСУ-Л004] РА ФЛАП ПРАВ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_INTERC_L_NO_RESERVE_BIT   11     //!< [АБСУ-Л005] РА ИНТЕРЦ ЛЕВ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_INTERC_R_NO_RESERVE_BIT   12     //!< [АБСУ-Л006] РА ИНТЕРЦ ПРАВ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_ABSU_LIMIT_BIT                 13     //!< [АБСУ-Л007] ОГРАНИЧЬ АЛЬФУ, ny, ГАММУ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_BALANCE_FAILURE_BIT            14     //!< [АБСУ-Л008] AВТОБАЛАНС ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_SET_M09_CHI35_BIT              15     //!< [АБСУ-Л009] ПЕРЕЙДИ М<0.9 ХИ<35 (ДВ/С)
+#define MFCI_SIGNALS_WORD_24_MASK                           0xffff //!< Маска признаков слова 24 сигнализации МФЦИ
+
+//! Признаки слова 25 сигнализации МФЦИ (mfci_signals_word_25_b_t)
+#define MFCI_SIGNALS_WORD_25_ROLL_CAREFUL_BIT            0      //!< [АБСУ-Л010] УПРАВЛЯЙ КРЕНОМ ПЛАВНО (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_SET_V900_BIT                1      //!< [АБСУ-Л011] ПЕРЕЙДИ НА V<900 (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_ABSU_LANDING_FLAP_15_BIT    2      //!< [АБСУ-Л012] ПОСАДКА ЗАКРЛК 15, V>300 (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_FLAP_UNSTABLE_BIT           3      //!< [АБСУ-Л013] ЗАКРЛК ПАРИРУЙ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_BAD_SIDE_CONTROLS_BIT       4      //!< [АБСУ-Л014] БОК УПРАВЛ СНИЖЕНО (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_VT_FAILURE_BIT              5      //!< [АБСУ-Л015] ВОЗД ТОРМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_PEDALS_FAILURE_BIT          6      //!< [АБСУ-Л016] УПРАВЛ ПЕДАЛЯМИ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_ROLL_NO_NEUTRAL_BIT         7      //!< [АБСУ-Л017] КРЕН НЕЙТРАЛИ НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_HEADING_NO_NEUTRAL_BIT      8      //!< [АБСУ-Л018] КУРС НЕЙТРАЛИ НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_FLAP_FAILURE_BIT            9      //!< [СМК-Л001] ЗАКРЛК ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_SLAT_FAILURE_BIT            10     //!< [СМК-Л002] ПРЕДКР ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_FLAP_CORRECTION_FAILURE_BIT 11     //!< [СМК-Л003] ЗАКРЛ-ПРЕДКР КОРРЕКЦИЯ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_FLAP_TRACK_MODE_FAILURE_BIT 12     //!< [СМК-Л005] ЗАКРЛК-ПРЕДКР СЛЕДЯЩ РЕЖИМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_FLAP_ASYNC_BIT              13     //!< [СМК-Л007] ЗАКРЛК РАССИНХ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_SLAT_ASYNC_BIT              14     //!< [СМК-Л008] ПРЕДКР РАССИНХ (ДВ/С)
+#define MFCI_SIGNALS_WORD_25_FLAP_NOT_READY_BIT          15     //!< [СМК-Л009] ЗАКРЛК НЕВЗЛЕТ (НЕ ГОТОВ К ВЗЛЁТУ)
+#define MFCI_SIGNALS_WORD_25_MASK                        0xffff //!< Маска признаков слова 25 сигнализации МФЦИ
+
+//! Признаки слова 26 сигнализации МФЦИ (mfci_signals_word_26_b_t)
+#define MFCI_SIGNALS_WORD_26_FLAP_LEFT_SLOW_BIT            0      //!< [СМК-Л010] ЗАКРЛ ЛЕВ ЗАТОРМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_FLAP_RIGHT_SLOW_BIT           1      //!< [СМК-Л011] ЗАКРЛ ПРАВ ЗАТОРМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_WING_TRACK_MODE_FAILURE_BIT   2      //!< [СМК-Л012] КРЫЛО СЛЕДЯЩ РЕЖИМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_WING_FAILURE_BIT              3      //!< [СМК-Л013] КРЫЛО ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_WING_ASYNC_BIT                4      //!< [СМК-Л015] КРЫЛО РАССИНХ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_SEAT_PILOT_1_MOVED_BACK_BIT   5      //!< [СК-Д001] КРЕСЛО КОМАНДИРА ОТКАТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_SEAT_PILOT_2_MOVED_BACK_BIT   6      //!< [СК-Д002] КРЕСЛО ПОМОЩНИКА ОТКАТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_MAIN_BRAKES_FAILURE_1_BIT     7      //!< [ТОРМ-Д401] ТОРМ ОСН ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_EMERG_BRAKES_FAILURE_BIT      8      //!< [ТОРМ-Д601] ТОРМ РЕЗЕРВ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_EMERG_BRAKES_ON_BIT           9      //!< [ТОРМ-Д603] ТОРМ РЕЗЕРВ ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_BRAKES_LOW_ACCUM_PRESSURE_BIT 10     //!< [ТОРМ-Д620] ТОРМ ДАВЛ Г/АКК МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_EMERGENCY_BRAKING_BIT         11     //!< [ТОРМ-Д622] ТОРМОЖЕНИЕ АВАРИЙНОЕ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_AUTO_BRAKES_OFF_BIT           12     //!< [ТОРМ-Л002] ТОРМ АВТ ОТКЛЮЧЕНО (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_GEAR_ON_BRAKES_BIT            13     //!< [ТОРМ-Л004] КОЛЕСА ЗАТОРМОЖЕНЫ (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_START_BRAKING_BIT             14     //!< [ТОРМ-Л005] СТАРТ ТОРМ ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_PARKING_BRAKE_ON_BIT          15     //!< [ТОРМ-Л007] СТОЯН ТОРМ ВКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_26_MASK                          0xffff //!< Маска признаков слова 26 сигнализации МФЦИ
+
+//! Признаки слова 27 сигнализации МФЦИ (mfci_signals_word_27_b_t)
+#define MFCI_SIGNALS_WORD_27_AUTO_BRAKES_SLIGHT_BIT       0      //!< [ТОРМ-Л008] ТОРМОЖЕНИЕ АВТ СЛАБО (ДВ/С)
+#define MFCI_SIGNALS_WORD_27_AUTO_BRAKES_LOW_BIT          1      //!< [ТОРМ-Л009] ТОРМОЖЕНИЕ АВТ ПОНИЖ (ДВ/С)
+#define MFCI_SIGNALS_WORD_27_AUTO_BRAKES_NORMAL_BIT       2      //!< [ТОРМ-Л010] ТОРМОЖЕНИЕ АВТ НОРМ (ДВ/С)
+#define MFCI_SIGNALS_WORD_27_BRAKES_PAIR_FAILURE_BIT      3      //!< [ТОРМ-Л011] ТОРМ ОДНА ПАРА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_27_MAIN_BRAKES_FAILURE_3_BIT    4      //!< [ТОРМ-Л012] ТОРМ ОСН ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN1_NOT_ACTIVE_BIT 5      //!< [СЭС-Д201] СЭС 115В ГЕН1 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN2_NOT_ACTIVE_BIT 6      //!< [СЭС-Д202] СЭС 115В ГЕН2 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN3_NOT_ACTIVE_BIT 7      //!< [СЭС-Д203] СЭС 115В ГЕН3 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN4_NOT_ACTIVE_BIT 8      //!< [СЭС-Д204] СЭС 115В ГЕН4 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN1_OVERLOAD_BIT   9      //!< [СЭС-Д209] СЭС 115В ГЕН1 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN2_OVERLOAD_BIT   10     //!< [СЭС-Д210] СЭС 115В ГЕН2 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN3_OVERLOAD_BIT   11     //!< [СЭС-Д211] СЭС 115В ГЕН3 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_GEN4_OVERLOAD_BIT   12     //!< [СЭС-Д212] СЭС 115В ГЕН4 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_PARTIAL_LEFT_BIT    13     //!< [СЭС-Д231] СЭС 115В СЕТЬ ЛЕВ ЧАСТИЧ РЕЖИМ (СИГН)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_PARTIAL_RIGHT_BIT   14     //!< [СЭС-Д232] СЭС 115В СЕТЬ ПРАВ ЧАСТИЧ РЕЖИМ (СИГН)
+#define MFCI_SIGNALS_WORD_27_SAS_115V_CONNECTED_BIT       15     //!< [СЭС-Д233] СЭС 115В СЕТИ СОЕДИНЕНЫ (СИГН)
+#define MFCI_SIGNALS_WORD_27_MASK                         0xffff //!< Маска признаков слова 27 сигнализации МФЦИ
+
+//! Признаки слова 28 сигнализации МФЦИ (mfci_signals_word_28_b_t)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_BRZU_GEN1_FAILURE_BIT 0      //!< [СЭС-Л006] СЭС 115В БРЗУ ГЕН1 ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_BRZU_GEN2_FAILURE_BIT 1      //!< [СЭС-Л007] СЭС 115В БРЗУ ГЕН2 ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_BRZU_GEN3_FAILURE_BIT 2      //!< [СЭС-Л008] СЭС 115В БРЗУ ГЕН3 ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_BRZU_GEN4_FAILURE_BIT 3      //!< [СЭС-Л009] СЭС 115В БРЗУ ГЕН4 ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_BRZU_VSU_FAILURE_BIT  4      //!< [СЭС-Л010] СЭС 115В БРЗУ ГЕН ВСУ ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_TRANSD1_FAILURE_BIT   5      //!< [СЭС-Л011] СЭС 115В ПРЕОБР1 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_TRANSD3_FAILURE_BIT   6      //!< [СЭС-Л013] СЭС 115В ПРЕОБР3 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_TURN_OFF_PPO_GEN1_BIT 7      //!< [СЭС-Л018] СЭС 115В ППО ГЕН1 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_TURN_OFF_PPO_GEN2_BIT 8      //!< [СЭС-Л019] СЭС 115В ППО ГЕН2 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_TURN_OFF_PPO_GEN3_BIT 9      //!< [СЭС-Л020] СЭС 115В ППО ГЕН3 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_115V_TURN_OFF_PPO_GEN4_BIT 10     //!< [СЭС-Л021] СЭС 115В ППО ГЕН4 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_27V_CONNECTED_BIT          11     //!< [СЭС-Д325] СЭС 27В СЕТИ СОЕДИНЕНЫ (СИГН)
+#define MFCI_SIGNALS_WORD_28_SAS_27V_GEN1_NOT_ACTIVE_BIT    12     //!< [СЭС-Д301] СЭС 27В Г1 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_28_SAS_27V_GEN2_NOT_ACTIVE_BIT    13     //!< [СЭС-Д302] СЭС 27В Г2 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_28_SAS_27V_GEN3_NOT_ACTIVE_BIT    14     //!< [СЭС-Д303] СЭС 27В Г3 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_28_SAS_27V_GEN4_NOT_ACTIVE_BIT    15     //!< [СЭС-Д304] СЭС 27В Г4 НЕ РАБОТАЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_28_MASK                           0xffff //!< Маска признаков слова 28 сигнализации МФЦИ
+
+//! Признаки слова 29 сигнализации МФЦИ (mfci_signals_word_29_b_t)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_GEN1_OVERLOAD_BIT     0      //!< [СЭС-Д309] СЭС 27В Г1 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_GEN2_OVERLOAD_BIT     1      //!< [СЭС-Д310] СЭС 27В Г2 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_GEN3_OVERLOAD_BIT     2      //!< [СЭС-Д311] СЭС 27В Г3 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_GEN4_OVERLOAD_BIT     3      //!< [СЭС-Д312] СЭС 27В Г4 ПЕРЕГРУЗКА (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_LEFT_ON_BATTERY_BIT   4      //!< [СЭС-Д321] СЭС 27В СЕТЬ ЛЕВ ОТ АКК (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_RIGHT_ON_BATTERY_BIT  5      //!< [СЭС-Д322] СЭС 27В СЕТЬ ПРАВ ОТ АКК (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_LEFT_PARTIAL_BIT      6      //!< [СЭС-Д323] СЭС 27В СЕТЬ ЛЕВ ЧАСТИЧ РЕЖИМ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_RIGHT_PARTIAL_BIT     7      //!< [СЭС-Д324] СЭС 27В СЕТЬ ПРАВ ЧАСТИЧ РЕЖИМ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_TURN_OFF_BATTERY1_BIT 8      //!< [СЭС-Л014] СЭС 27В АКК1 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_TURN_OFF_BATTERY2_BIT 9      //!< [СЭС-Л015] СЭС 27В АКК2 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_BATTERY1_OFF_BIT      10     //!< [СЭС-Л016] СЭС 27В АКК1 ОТКЛЮЧЕН (СОСТ)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_BATTERY2_OFF_BIT      11     //!< [СЭС-Л017] СЭС 27В АКК2 ОТКЛЮЧЕН (СОСТ)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_TURN_OFF_GEN1_BIT     12     //!< [СЭС-Л022] СЭС 27В Г1 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_TURN_OFF_GEN2_BIT     13     //!< [СЭС-Л023] СЭС 27В Г2 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_TURN_OFF_GEN3_BIT     14     //!< [СЭС-Л024] СЭС 27В Г3 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_29_SAS_27V_TURN_OFF_GEN4_BIT     15     //!< [СЭС-Л025] СЭС 27В Г4 ОТКЛЮЧИ (СИГН)
+#define MFCI_SIGNALS_WORD_29_MASK                          0xffff //!< Маска признаков слова 29 сигнализации МФЦИ
+
+//! Признаки слова 30 сигнализации МФЦИ (mfci_signals_word_30_b_t)
+#define MFCI_SIGNALS_WORD_30_GS_CROSSFEEDING_BIT        0      //!< [ГС-Д033] ГС КРАНЫ КОЛЬЦ ВКЛ (НЕ ГОТОВ К ВЗЛЁТУ)
+#define MFCI_SIGNALS_WORD_30_GS_TGT_CIRCUIT_FAILURE_BIT 1      //!< [ГС-Д034] КОНТУР ТЖТ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS_TGT_PUMP_FAILURE_BIT    2      //!< [ГС-Д035] НАСОС ТЖТ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS1_FAILURE_BIT            3      //!< [ГС-Л005] ГС1 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS2_FAILURE_BIT            4      //!< [ГС-Л006] ГС2 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS3_FAILURE_BIT            5      //!< [ГС-Л007] ГС3 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS4_FAILURE_BIT            6      //!< [ГС-Л008] ГС4 ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS2_PUMP1_OFF_BIT          7      //!< [ГС-Л047] ГС2 Н1 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS1_PUMP2_OFF_BIT          8      //!< [ГС-Л048] ГС1 Н2 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS2_PUMP3_OFF_BIT          9      //!< [ГС-Л049] ГС2 Н3 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS1_PUMP4_OFF_BIT          10     //!< [ГС-Л050] ГС1 Н4 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS4_PUMP5_OFF_BIT          11     //!< [ГС-Л051] ГС4 Н5 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS3_PUMP6_OFF_BIT          12     //!< [ГС-Л052] ГС3 Н6 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS4_PUMP7_OFF_BIT          13     //!< [ГС-Л053] ГС4 Н7 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_GS3_PUMP8_OFF_BIT          14     //!< [ГС-Л054] ГС3 Н8 ОТКЛЮЧЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_30_DV_PUMPS_FAILURE_BIT       15     //!< [ОС-Л020] Г/НАСОСЫ ДВ ОТКЛ (НЕ ГОТОВ К ВЗЛЁТУ)
+#define MFCI_SIGNALS_WORD_30_MASK                       0xffff //!< Маска признаков слова 30 сигнализации МФЦИ
+
+//! Признаки слова 31 сигнализации МФЦИ (mfci_signals_word_31_b_t)
+#define MFCI_SIGNALS_WORD_31_VSU_OIL_PRESSURE_LOW_BIT     0      //!< [ВСУ-Д001] ДАВЛЕНИЕ МАСЛА ПРЕДЕЛ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_TG_HIGH_BIT              1      //!< [ВСУ-Д002] ТЕМПЕР ГАЗА ПРЕДЕЛ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_N_HIGH_BIT               2      //!< [ВСУ-Д003] ОБОРОТЫ ПРЕДЕЛ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_CLOGGING_BIT             3      //!< [ВСУ-Д007] ТОПЛ ФИЛЬТР ЗАСОРЕН (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_SWARF_BIT                4      //!< [ВСУ-Д008] СТРУЖКА В МАСЛЕ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_FUEL_PRESSURE_NORMAL_BIT 5      //!< [ВСУ-Д009] ДАВЛЕНИЕ ТОПЛИВА (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_AIR_BLEED_BIT            6      //!< [ВСУ-Д010] ОТБОР ОТКРЫТ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_READY_BIT                7      //!< [ВСУ-Д012] ЗАПУСК ГОТОВ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_OIL_LEVEL_LOW_BIT        8      //!< [ВСУ-Д013] МАСЛА МАЛО (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_MODE_ACTIVE_BIT          9      //!< [ВСУ-Д014] РЕЖИМ (ВСУ, ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_31_VSU_UNSAFE_BIT               10     //!< [ВСУ-Д018] ЗАЩИТА ОТКЛЮЧЕНА (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_TEST_BIT                 11     //!< [ВСУ-Д019] КОНТРОЛЬ (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_OIL_TEMPERATURE_HIGH_BIT 12     //!< [ВСУ-Д020] ТЕМПЕР МАСЛА ВЕЛИКА (ВСУ)
+#define MFCI_SIGNALS_WORD_31_VSU_WARNING_BIT              13     //!< [ВСУ-Л002] ВСУ НЕИСПРАВНОСТЬ (СОСТ)
+#define MFCI_SIGNALS_WORD_31_VSU_FAILURE_BIT              14     //!< [ВСУ-Л003] ВСУ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_31_VSU_TURNED_OFF_BIT           15     //!< [ВСУ-Л004] ВСУ АВАРИЙНЫЙ ОСТАНОВ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_31_MASK                         0xffff //!< Маска признаков слова 31 сигнализации МФЦИ
+
+//! Признаки слова 32 сигнализации МФЦИ (mfci_signals_word_32_b_t)
+#define MFCI_SIGNALS_WORD_32_VSU_N_HIGH_BIT               0      //!< [ВСУ-Л005] ОБОРОТЫ ВЕЛИКИ (ВСУ)
+#define MFCI_SIGNALS_WORD_32_VSU_TG_HIGH_BIT              1      //!< [ВСУ-Л006] ТЕМПЕР ГАЗА ВЕЛИКА (ВСУ)
+#define MFCI_SIGNALS_WORD_32_VSU_OIL_PRESSURE_LOW_BIT     2      //!< [ВСУ-Л007] ДАВЛЕНИЕ МАСЛА МАЛО (ВСУ)
+#define MFCI_SIGNALS_WORD_32_VSU_SHUTTERS_OPENED_BIT      3      //!< [ВСУ-Л008] СТВОРКИ ОТКРЫТЫ (ВСУ, ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_LINE_LEFT_FAILURE_BIT    4      //!< [СКВ-Д024] СКВ МАГИСТРАЛЬ ЛЕВ ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_LINE_RIGHT_FAILURE_BIT   5      //!< [СКВ-Д025] СКВ МАГИСТРАЛЬ ПРАВ ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_DV_LEFT_FAILURE_BIT      6      //!< [СКВ-Д026] СКВ ОТБОР ЛЕВОГО БОРТА ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_DV_RIGHT_FAILURE_BIT     7      //!< [СКВ-Д027] СКВ ОТБОР ПРАВОГО БОРТА ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_THU1_FAILURE_BIT         8      //!< [СКВ-Д028] СКВ ТХУ1 КАБИНЫ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_32_SKV_THU2_FAILURE_BIT         9      //!< [СКВ-Д029] СКВ ТХУ2 ПЕРЕДН ТО ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_32_SKV_THU3_FAILURE_BIT         10     //!< [СКВ-Д030] СКВ ТХУ3 СРЕДН ТО ЛЕВ, ПЕРЕДН ГО ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_32_SKV_THU4_FAILURE_BIT         11     //!< [СКВ-Д031] СКВ ТХУ4 СРЕДН ТО ПРАВ, ЗАДН ГО ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_32_SKV_THU_FAILURE_BIT          12     //!< [СКВ-Д032] СКВ ТХУ ОТКАЗ / РЭП ОХЛАЖД ОТКАЗ (СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_PRESSURE_LOW_BIT         13     //!< [СКВ-Д033] СКВ ПОДАЧИ НЕТ (СИГН)
+#define MFCI_SIGNALS_WORD_32_SKV_VSU_HEATING_FAILURE_BIT  14     //!< [СКВ-Д036] СКВ ОБОГРЕВ ОТСЕКА ВСУ ОТКАЗ (СИГН, ВСУ)
+#define MFCI_SIGNALS_WORD_32_SKV_ZTO_TEMPERATURE_HIGH_BIT 15     //!< [СКВ-Д037] СКВ ЗАДН ТО ПЕРЕГРЕВ (СИГН)
+#define MFCI_SIGNALS_WORD_32_MASK                         0xffff //!< Маска признаков слова 32 сигнализации МФЦИ
+
+//! Признаки слова 33 сигнализации МФЦИ (mfci_signals_word_33_b_t)
+#define MFCI_SIGNALS_WORD_33_CABIN_HIGH_PRESSURE_BIT     0      //!< [СКВ-Д300] КАБИНА ДАВЛ ВЕЛИКО (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_33_CABIN_LOSS_PRESSURE_BIT     1      //!< [СКВ-Д301] КАБИНА ДАВЛ МАЛО (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_33_RTR_SAP_COOLING_FAILURE_BIT 2      //!< [СКВ-Д035] РТР И САП ОХЛАЖД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_COMPARE_HEADING_BIT         3      //!< [УПР-Д051] КУРС СРАВНИ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_33_COMPARE_ROLL_BIT            4      //!< [УПР-Д052] КРЕН СРАВНИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_33_COMPARE_PITCH_BIT           5      //!< [УПР-Д053] ТАНГАЖ СРАВНИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_33_COMPARE_INDICATED_SPEED_BIT 6      //!< [УПР-Д055] СРАВНИ ПРИБОРНУЮ СКОРОСТЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_33_COMPARE_ALTITUDE_BIT        7      //!< [УПР-Д056] СРАВНИ БАРОВЫСОТУ (ДВ/С)
+#define MFCI_SIGNALS_WORD_33_MAP_FAILURE_BIT             8      //!< [СОИ-Л064] КАРТА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_BGS1_FAILURE_BIT            9      //!< [СОИ] ГРАФИЧ СТАНЦИЯ 1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_BGS2_FAILURE_BIT            10     //!< [СОИ] ГРАФИЧ СТАНЦИЯ 2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_BGS_RESERVE_FAILURE_BIT     11     //!< [СОИ-Л065] БГС РЕЗЕРВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_BIS1_FAILURE_BIT            12     //!< [СОИ] БИС1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_BIS2_FAILURE_BIT            13     //!< [СОИ] БИС2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_BIS_RESERVE_FAILURE_BIT     14     //!< [СОИ-Л066] БИС РЕЗЕРВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_33_MASK                        0x7fff //!< Маска признаков слова 33 сигнализации МФЦИ
+
+//! Признаки слова 34 сигнализации МФЦИ (mfci_signals_word_34_b_t)
+#define MFCI_SIGNALS_WORD_34_INS1_NOT_NAV_MODE_BIT    0      //!< [ИНС-Д006] ИНС1 НЕ ВЫСТАВЛЕНА (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS2_NOT_NAV_MODE_BIT    1      //!< [ИНС-Д007] ИНС2 НЕ ВЫСТАВЛЕНА (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS3_NOT_NAV_MODE_BIT    2      //!< [ИНС-Д008] ИНС3 НЕ ВЫСТАВЛЕНА (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS1_FAILURE_BIT         3      //!< [ИНС-Л001] ИНС1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS2_FAILURE_BIT         4      //!< [ИНС-Л002] ИНС2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS3_FAILURE_BIT         5      //!< [ИНС-Л003] ИНС3 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS12_FAILURE_BIT        6      //!< [ИНС-Л004] ИНС12 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS13_FAILURE_BIT        7      //!< [ИНС-Л005] ИНС13 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS23_FAILURE_BIT        8      //!< [ИНС-Л006] ИНС23 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS_FAILURE_BIT          9      //!< [ИНС-Л007] ИНС ОТКАЗ (ДВ/С, СИГН, СОСТ)
+#define MFCI_SIGNALS_WORD_34_INS_RESERVE_FAILURE_BIT  10     //!< [ИНС-Л008] ИНС РЕЗЕРВА НЕТ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_34_INS_NOT_NAV_MODE_BIT     11     //!< [СОИ-Л102] ИНС НЕ ВЫСТАВЛ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_34_ANS_NOT_NAV_MODE_BIT     12     //!< [АНС-Л002] АНС НЕ ВЫСТАВЛ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_PPD1_HEATING_FAILURE_BIT 13     //!< [СВС-Д004] ППД 1 ОБОГРЕВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_PPD2_HEATING_FAILURE_BIT 14     //!< [СВС-Д005] ППД 2 ОБОГРЕВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_PPD3_HEATING_FAILURE_BIT 15     //!< [СВС-Д006] ППД 3 ОБОГРЕВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_34_MASK                     0xffff //!< Маска признаков слова 34 сигнализации МФЦИ
+
+//! Признаки слова 35 сигнализации МФЦИ (mfci_signals_word_35_b_t)
+#define MFCI_SIGNALS_WORD_35_SVS1_NO_CORRECTION_BIT        0      //!< [СВС-Д007] СВС1 НЕТ КОРРЕКЦИИ ПО ВЫСОТЕ И СКОРОСТИ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS2_NO_CORRECTION_BIT        1      //!< [СВС-Д008] СВС2 НЕТ КОРРЕКЦИИ ПО ВЫСОТЕ И СКОРОСТИ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS3_NO_CORRECTION_BIT        2      //!< [СВС-Д009] СВС3 НЕТ КОРРЕКЦИИ ПО ВЫСОТЕ И СКОРОСТИ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_DAU_LEFT_HEATING_FAILURE_BIT  3      //!< [СВС-ДХХХ] ДАУ ЛЕВ ОБОГРЕВА НЕТ
+#define MFCI_SIGNALS_WORD_35_DAU_RIGHT_HEATING_FAILURE_BIT 4      //!< [СВС-ДХХХ] ДАУ ПРАВ ОБОГРЕВА НЕТ
+#define MFCI_SIGNALS_WORD_35_SVS1_FAILURE_BIT              5      //!< [СВС-Л001] СВС1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS2_FAILURE_BIT              6      //!< [СВС-Л002] СВС2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS3_FAILURE_BIT              7      //!< [СВС-Л003] СВС3 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS12_FAILURE_BIT             8      //!< [СВС-Л004] СВС12 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS13_FAILURE_BIT             9      //!< [СВС-Л005] СВС13 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS23_FAILURE_BIT             10     //!< [СВС-Л006] СВС23 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_35_SVS_FAILURE_BIT               11     //!< [СВС-Л007] СВС ОТКАЗ (ДВ/С, СИГН, СОСТ)
+#define MFCI_SIGNALS_WORD_35_PPD_HEATING_FAILURE_1_BIT     12     //!< [СВС-Л008] ППД ОБОГРЕВА НЕТ (НЕ ГОТОВ К ВЗЛЁТУ)
+#define MFCI_SIGNALS_WORD_35_PPD_HEATING_FAILURE_2_BIT     13     //!< [СВС-Л009] ППД ОБОГРЕВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_35_SVS_RESERVE_FAILURE_BIT       14     //!< [СВС-Л010] СВС РЕЗЕРВА НЕТ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_35_SVS_NO_CORRECTION_BIT         15     //!< [СВС-Л011] СВС НЕТ КОРРЕКЦИИ ПО ВЫСОТЕ И СКОРОСТИ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_35_MASK                          0xffff //!< Маска признаков слова 35 сигнализации МФЦИ
+
+//! Признаки слова 36 сигнализации МФЦИ (mfci_signals_word_36_b_t)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_50_BIT                0      //!< [КИСЛ-Д001] КИСЛОРОД < 50% (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_20_BIT                1      //!< [КИСЛ-Д002] КИСЛОРОД < 20% (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_FAILURE_1_BIT         2      //!< [КИСЛ-Д003] КИСЛОРОД ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_FAILURE_2_BIT         3      //!< [КИСЛ-Д004] КИСЛОРОД ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_USE_OXYGEN_BIT               4      //!< [КИСЛ-Д005] КИСЛОРОД ИСПОЛЬЗУЙ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_PILOT1_LOW_BIT        5      //!< [КИСЛ-Д006] КИСЛОРОДА КОМАНДИРА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_PILOT2_LOW_BIT        6      //!< [КИСЛ-Д007] КИСЛОРОДА ПОМОЩНИКА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_OPERATOR_LOW_BIT      7      //!< [КИСЛ-Д008] КИСЛОРОДА ОПЕРАТОРА НЕТ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_NAVIGATOR_LOW_BIT     8      //!< [КИСЛ-Д009] КИСЛОРОДА ШТУРМАНА НЕТ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_PILOT1_FAILURE_BIT    9      //!< [КИСЛ-Д010] КИСЛОРОД КОМАНДИРА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_PILOT2_FAILURE_BIT    10     //!< [КИСЛ-Д011] КИСЛОРОД ПОМОЩНИКА ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_OPERATOR_FAILURE_BIT  11     //!< [КИСЛ-Д012] КИСЛОРОД ОПЕРАТОРА ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_NAVIGATOR_FAILURE_BIT 12     //!< [КИСЛ-Д013] КИСЛОРОД ШТУРМАНА ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_36_CHARGE_OXYGEN_BIT            13     //!< [КИСЛ-Д014] КИСЛОРОД ЗАРЯДИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_ON_BIT                14     //!< [КИСЛ-Д015] КИСЛОРОД ВКЛ (СОСТ)
+#define MFCI_SIGNALS_WORD_36_OXYGEN_OFF_BIT               15     //!< [КИСЛ-Л001] КИСЛОРОД ОТКЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_36_MASK                         0xffff //!< Маска признаков слова 36 сигнализации МФЦИ
+
+//! Признаки слова 37 сигнализации МФЦИ (mfci_signals_word_37_b_t)
+#define MFCI_SIGNALS_WORD_37_OXYGEN_PILOT1_PRESSURE_NORMAL_BIT    0      //!< [КИСЛ-Д017] Командир корабля - давление норма
+#define MFCI_SIGNALS_WORD_37_OXYGEN_PILOT1_FEEDING_BIT            1      //!< [КИСЛ-Д019] Командир корабля - подача на дыхание
+#define MFCI_SIGNALS_WORD_37_OXYGEN_PILOT2_PRESSURE_NORMAL_BIT    2      //!< [КИСЛ-Д020] Помощник командира - давление норма
+#define MFCI_SIGNALS_WORD_37_OXYGEN_PILOT2_FEEDING_BIT            3      //!< [КИСЛ-Д022] Помощник командира - подача на дыхание
+#define MFCI_SIGNALS_WORD_37_OXYGEN_OPERATOR_PRESSURE_NORMAL_BIT  4      //!< [КИСЛ-Д023] Штурман-оператор - давление норма
+#define MFCI_SIGNALS_WORD_37_OXYGEN_OPERATOR_FEEDING_BIT          5      //!< [КИСЛ-Д025] Штурман-оператор - подача на дыхание
+#define MFCI_SIGNALS_WORD_37_OXYGEN_NAVIGATOR_PRESSURE_NORMAL_BIT 6      //!< [КИСЛ-Д026] Штурман-навигатор - давление норма
+#define MFCI_SIGNALS_WORD_37_OXYGEN_NAVIGATOR_FEEDING_BIT         7      //!< [КИСЛ-Д028] Штурман-навигатор - подача на дыхание
+#define MFCI_SIGNALS_WORD_37_GEAR_FRONT_PRESSURE_LOW_BIT          8      //!< [ШАСС-Д016] ШАССИ ПЕРЕДН ДАВЛ МАЛО (СОСТ)
+#define MFCI_SIGNALS_WORD_37_GEAR_LEFT_PRESSURE_LOW_BIT           9      //!< [ШАСС-Д017] ШАССИ ЛЕВ ДАВЛ МАЛО (СОСТ)
+#define MFCI_SIGNALS_WORD_37_GEAR_RIGHT_PRESSURE_LOW_BIT          10     //!< [ШАСС-Д018] ШАССИ ПРАВ ДАВЛ МАЛО (СОСТ)
+#define MFCI_SIGNALS_WORD_37_GEAR_PRESSURE_LOW_BIT                11     //!< [ШАСС-Л003] ШАССИ ДАВЛ МАЛО (ДВ/С)
+#define MFCI_SIGNALS_WORD_37_GEAR_CHECK_BIT                       12     //!< [ШАСС-Л004] ШАССИ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_37_GEAR_DOWN_BIT                        13     //!< [ШАСС-Л005] ШАССИ ВЫПУСТИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_37_GEAR_LOCKED_BIT                      14     //!< [ШАСС-Л006] ШАССИ УБОРКА НЕВОЗМОЖНА ЗАМОК ЗАКРЫТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_37_ICING_BIT                            15     //!< [ЛЕД-Л001] ОБЛЕДЕНЕНИЕ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_37_MASK                                 0xffff //!< Маска признаков слова 37 сигнализации МФЦИ
+
+//! Признаки слова 38 сигнализации МФЦИ (mfci_signals_word_38_b_t)
+#define MFCI_SIGNALS_WORD_38_NAV_LZP_CHANGED_BIT        0      //!< [БЦВМ-Д007] НАВ СМЕНА ЛЗП (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_NAV_FUEL_LOW_BIT           1      //!< [БЦВМ-Д009] НАВ ФАКТИЧ ЗАПАС ТОПЛИВА НИЖЕ ТРЕБУЕМОГО (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_NAV_GO_AROUND_BIT          2      //!< [БЦВМ-Д010] НАВ УХОД НА 2 КРУГ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_BR_BIT                     3      //!< [БЦВМ] БОЕВОЙ РЕЖИМ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_NAV_RESERVE_FAILURE_BIT    4      //!< [БЦВМ-Д018] НАВ СЧИСЛЕН РЕЗЕРВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_38_NAV_ROUTE_FAILURE_BIT      5      //!< [БЦВМ-Д019] НАВ МАРШРУТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_38_NAV_RETURN_BIT             6      //!< [БЦВМ-Д027] НАВ ВОЗВРАТ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_NAV_FAILURE_BIT            7      //!< [БЦВМ-Д028] НАВ СЧИСЛЕН ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_BVD1_FAILURE_BIT           8      //!< [БЦВМ] БВД1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_38_BVD2_FAILURE_BIT           9      //!< [БЦВМ] БВД2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_38_DANGEROUS_APPROACH_BIT     10     //!< [ФПО НО-Б001] ГРУП ДИСТАНЦИЯ ОПАСНАЯ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_UR_FAILURE_BIT             11     //!< [БЦВМ-Л001] ПУСК УР ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_38_UR_RESERVE_FAILURE_BIT     12     //!< [БЦВМ-Л002] ПУСК УР РЕЗЕРВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_38_UNIT_TASK_CORR_FAILURE_BIT 13     //!< [БЦВМ-Л063] КОРР ЗАДАНИЯ ИЗД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_38_BCVM1_BP_FAILURE_BIT       14     //!< [БЦВМ] БЦВМ1 БП ОТКАЗ
+#define MFCI_SIGNALS_WORD_38_BCVM2_BP_FAILURE_BIT       15     //!< [БЦВМ] БЦВМ2 БП ОТКАЗ
+#define MFCI_SIGNALS_WORD_38_MASK                       0xffff //!< Маска признаков слова 38 сигнализации МФЦИ
+
+//! Признаки слова 39 сигнализации МФЦИ (mfci_signals_word_39_b_t)
+#define MFCI_SIGNALS_WORD_39_BCVM1_UNIT_TASK_CORR_FAILURE_BIT 0      //!< [БЦВМ] БЦВМ1 КОРР ЗАДАНИЯ ОТКАЗ
+#define MFCI_SIGNALS_WORD_39_BCVM2_UNIT_TASK_CORR_FAILURE_BIT 1      //!< [БЦВМ] БЦВМ2 КОРР ЗАДАНИЯ ОТКАЗ
+#define MFCI_SIGNALS_WORD_39_BCVM1_KANS_FAILURE_BIT           2      //!< [БЦВМ] БЦВМ1 КЭНС ОТКАЗ
+#define MFCI_SIGNALS_WORD_39_BCVM2_KANS_FAILURE_BIT           3      //!< [БЦВМ] БЦВМ2 КЭНС ОТКАЗ
+#define MFCI_SIGNALS_WORD_39_RAP_ATTACK_LEFT_BIT              4      //!< [РЭП-Б007] РЭП АТАКА СЛЕВА (ДВ/С)
+#define MFCI_SIGNALS_WORD_39_RAP_ATTACK_RIGHT_BIT             5      //!< [РЭП-Б005] РЭП АТАКА СПРАВА (ДВ/С)
+#define MFCI_SIGNALS_WORD_39_RAP_ATTACK_BELOW_BIT             6      //!< [РЭП-Д003] РЭП АТАКА СНИЗУ (ДВ/С)
+#define MFCI_SIGNALS_WORD_39_RAP_ATTACK_ABOVE_BIT             7      //!< [РЭП-Д004] РЭП АТАКА СВЕРХУ (ДВ/С)
+#define MFCI_SIGNALS_WORD_39_RAP_ATTACK_FRONT_BIT             8      //!< [РЭП-Б004] РЭП АТАКА СПЕРЕДИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_39_RAP_ATTACK_REAR_BIT              9      //!< [РЭП-Б006] РЭП АТАКА СЗАДИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_39_RAP_GUIDANCE_BIT                 10     //!< [РЭП-Б011] РЭП НАВЕДЕНИЕ
+#define MFCI_SIGNALS_WORD_39_RAP_TRACKING_BIT                 11     //!< [РЭП-Б010] РЭП СОПРОВОЖДЕНИЕ
+#define MFCI_SIGNALS_WORD_39_RAP_FAILURE_BIT                  12     //!< [РЭП-Б753] РЭП ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_39_RAP_FINDER_FAILURE_BIT           13     //!< [РЭП-Д007] РЭП ТЕПЛОПЕЛЕНГАТОР ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_39_RAP_LAZER_FAILURE_BIT            14     //!< [РЭП-Д008] РЭП ЛАЗЕРНАЯ СИСТЕМА ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_39_RAP_UV_VALVES_FAILURE_BIT        15     //!< [СТВР-Д001] РЭП СТВОРКИ УВ-5 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_39_MASK                             0xffff //!< Маска признаков слова 39 сигнализации МФЦИ
+
+//! Признаки слова 40 сигнализации МФЦИ (mfci_signals_word_40_b_t)
+#define MFCI_SIGNALS_WORD_40_RAP_UV_FAILURE_BIT         0      //!< [РЭП-Д009] РЭП УВ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_RECV_FAILURE_BIT       1      //!< [РЭП-Д010] РЭП ПРИЕМНИК РТР ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_SENDER_FAILURE_BIT     2      //!< [РЭП-Б756] РЭП ПЕРЕДАТЧИК ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_RECV_LEFT_FAILURE_BIT  3      //!< [РЭП-Б768] РЭП ЛЕВ ПРИЕМНЫЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_RECV_RIGHT_FAILURE_BIT 4      //!< [РЭП-Б777] РЭП ПРАВ ПРИЕМНЫЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_RECV_REAR_FAILURE_BIT  5      //!< [РЭП-Б786] РЭП ЗАДН ПРИЕМНЫЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_SEND_FRONT_FAILURE_BIT 6      //!< [РЭП-Б794] РЭП ПЕРЕДН ПЕРЕДАЮЩИЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_SEND_LEFT_FAILURE_BIT  7      //!< [РЭП-Б799] РЭП ЛЕВ ПЕРЕДАЮЩИЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_SEND_RIGHT_FAILURE_BIT 8      //!< [РЭП-Б811] РЭП ПРАВ ПЕРЕДАЮЩИЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_SEND_REAR_FAILURE_BIT  9      //!< [РЭП-Б823] РЭП ЗАДН ПЕРЕДАЮЩИЙ ПОСТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_UNIT1_FAILURE_BIT      10     //!< [РЭП-Б703] РЭП ИЗД1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_UNIT2_FAILURE_BIT      11     //!< [РЭП-Б722] РЭП ИЗД2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_RAP_UNIT5_FAILURE_BIT      12     //!< [РЭП-Б737] РЭП ИЗД5 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_40_FIRE_EMERGENCY_BIT         13     //!< [К070-Д001] СБРОСЬ ГРУЗ АВАРИЙНО (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_40_TSP_SPEC_ON_BIT            14     //!< [К070-Д002] ТСП/СПЕЦ ВКЛЮЧИ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_40_TSP_SPEC_OFF_BIT           15     //!< [К070-Д003] ТСП/СПЕЦ ОТКЛЮЧИ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_40_MASK                       0xffff //!< Маска признаков слова 40 сигнализации МФЦИ
+
+//! Признаки слова 41 сигнализации МФЦИ (mfci_signals_word_41_b_t)
+#define MFCI_SIGNALS_WORD_41_OPEN_GO_BIT                 0      //!< [К070-Д004] СТВОРКИ ПГО И ЗГО ОТКРОЙ ВРУЧНУЮ (СИГН)
+#define MFCI_SIGNALS_WORD_41_CLOSE_GO_BIT                1      //!< [К070-Д005] СТВОРКИ ПГО И ЗГО ЗАКРОЙ ВРУЧНУЮ (СИГН)
+#define MFCI_SIGNALS_WORD_41_SUO_FAILURE_BIT             2      //!< [К070-Д006] СУО ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_KAV_FAILURE_BIT             3      //!< [К070-Д007] КАВ ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_SUO_LANDING_NOT_READY_1_BIT 4      //!< [СУО-Д006] СУО ПОСАДКА ЗАПРЕЩЕНА, ДВИГАТЕЛЬ ВЫПУЩЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_41_SUO_LANDING_NOT_READY_2_BIT 5      //!< [СУО-Д007] СУО ПОСАДКА ЗАПРЕЩЕНА, СТВОРКИ ОТКРЫТЫ (ДВ/С)
+#define MFCI_SIGNALS_WORD_41_ASU_MESSAGE_BIT             6      //!< [АСУ-Д001] АСУ СООБЩЕНИЕ ПРИМИ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_ASU_FAILURE_BIT             7      //!< [АСУ-Д003] АСУ ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_ASU_CHECK_ROUTE_BIT         8      //!< [АСУ-Д008] АСУ МАРШРУТ ПРОВЕРЬ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_ASU_CHECK_BZ_BIT            9      //!< [АСУ-Д006] АСУ БЗ ПРОВЕРЬ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_ASU_LOCK_WEAPON_BIT         10     //!< [АСУ-Д007] АСУ ЗАБЛОКИРУЙ ОРУЖИЕ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_ASU_REPORT_BIT              11     //!< [АСУ-Д011] АСУ ДОНЕСЕНИЕ ВЫДАНО (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_URPZ_ONBZ_PREPARING_BIT     12     //!< [УРПЗ-Д001] ИДЕТ ФОРМИРОВАНИЕ ОНБЗ, время - XX:XX (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_CONTRAIL_CHECK_BIT          13     //!< [ФОВБ-Д001] ВИХРЬ ПРОВЕРЬ (ДВ/С)
+#define MFCI_SIGNALS_WORD_41_BKS_WEAPON_ENABLED_BIT      14     //!< [С505-Д001] РАЗБЛОКИРОВКА ОРУЖИЯ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_41_MASK                        0x7fff //!< Маска признаков слова 41 сигнализации МФЦИ
+
+//! Признаки слова 42 сигнализации МФЦИ (mfci_signals_word_42_b_t)
+#define MFCI_SIGNALS_WORD_42_MFI01_RESERVE_BIT 0      //!< [МФИ-Д001] МФИ1 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI02_RESERVE_BIT 1      //!< [МФИ-Д002] МФИ2 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI03_RESERVE_BIT 2      //!< [МФИ-Д003] МФИ3 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI04_RESERVE_BIT 3      //!< [МФИ-Д004] МФИ4 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI05_RESERVE_BIT 4      //!< [МФИ-Д005] МФИ5 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI06_RESERVE_BIT 5      //!< [МФИ-Д006] МФИ6 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI07_RESERVE_BIT 6      //!< [МФИ-Д007] МФИ7 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI08_RESERVE_BIT 7      //!< [МФИ-Д008] МФИ8 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI09_RESERVE_BIT 8      //!< [МФИ-Д009] МФИ9 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI10_RESERVE_BIT 9      //!< [МФИ-Д010] МФИ10 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI11_RESERVE_BIT 10     //!< [МФИ-Д011] МФИ11 РЕЗЕРВ РЕЖИМ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI01_FAILURE_BIT 11     //!< [МФИ-Д012] МФИ1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI02_FAILURE_BIT 12     //!< [МФИ-Д013] МФИ2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI03_FAILURE_BIT 13     //!< [МФИ-Д014] МФИ3 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI04_FAILURE_BIT 14     //!< [МФИ-Д015] МФИ4 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MFI05_FAILURE_BIT 15     //!< [МФИ-Д016] МФИ5 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_42_MASK              0xffff //!< Маска признаков слова 42 сигнализации МФЦИ
+
+//! Признаки слова 43 сигнализации МФЦИ (mfci_signals_word_43_b_t)
+#define MFCI_SIGNALS_WORD_43_MFI06_FAILURE_BIT    0      //!< [МФИ-Д017] МФИ6 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFI07_FAILURE_BIT    1      //!< [МФИ-Д018] МФИ7 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFI08_FAILURE_BIT    2      //!< [МФИ-Д019] МФИ8 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFI09_FAILURE_BIT    3      //!< [МФИ-Д020] МФИ9 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFI10_FAILURE_BIT    4      //!< [МФИ-Д021] МФИ10 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFI11_FAILURE_BIT    5      //!< [МФИ-Д022] МФИ11 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFPU1_FAILURE_BIT    6      //!< [МФПУ1-Д001] МФПУ1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFPU2_FAILURE_BIT    7      //!< [МФПУ2-Д001] МФПУ2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_MFPU3_FAILURE_BIT    8      //!< [МФПУ3-Д001] МФПУ3 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_DEPRESSURIZATION_BIT 9      //!< [ЛЮКИ-Л001*] ЛЮКИ ГЕРМЕТ ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_43_CANOPY_1_BIT         10     //!< [ЛЮКИ-Л001] ФОНАРЬ ОТКРЫТ (НЕ ГОТОВ К ВЗЛЁТУ, СИГН)
+#define MFCI_SIGNALS_WORD_43_CANOPY_PILOT_1_BIT   11     //!< [ЛЮКИ-Л002] ФОНАРЬ КК ОТКРЫТ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_CANOPY_PILOT_2_BIT   12     //!< [ЛЮКИ-Л003] ФОНАРЬ ПКК ОТКРЫТ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_CANOPY_NAVIGATOR_BIT 13     //!< [ЛЮКИ-Л004] ФОНАРЬ ШК ОТКРЫТ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_CANOPY_OPERATOR_BIT  14     //!< [ЛЮКИ-Л005] ФОНАРЬ ШО ОТКРЫТ (СОСТ)
+#define MFCI_SIGNALS_WORD_43_CANOPY_2_BIT         15     //!< [ЛЮКИ-Л006] ФОНАРЬ ОТКРЫТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_43_MASK                 0xffff //!< Маска признаков слова 43 сигнализации МФЦИ
+
+//! Признаки слова 44 сигнализации МФЦИ (mfci_signals_word_44_b_t)
+#define MFCI_SIGNALS_WORD_44_PUI1_FAILURE_BIT     0      //!< [ПУИ1-Д001] ПУИ1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_PUI2_FAILURE_BIT     1      //!< [ПУИ2-Д001] ПУИ2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_MUP1_FAILURE_BIT     2      //!< [МУП1-Д001] МУП1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_MUP2_FAILURE_BIT     3      //!< [МУП2-Д001] МУП2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_VIM1_FAILURE_BIT     4      //!< [VIM1-Д001] VIM1: ILS, VOR ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_VIM2_FAILURE_BIT     5      //!< [VIM2-Д001] VIM2: ILS, VOR ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_RVM1_FAILURE_BIT     6      //!< [РВМ1-Д001] РВм1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_RVM2_FAILURE_BIT     7      //!< [РВМ2-Д001] РВм2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_RVB_FAILURE_BIT      8      //!< [РВБ-Д001] РВб ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_SD75_1_FAILURE_BIT   9      //!< [DME1-Д001] ДАЛЬНОМЕР1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_SD75_2_FAILURE_BIT   10     //!< [DME2-Д001] ДАЛЬНОМЕР2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_RSBN_FAILURE_BIT     11     //!< [РСБН-Д006] РСБН ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_ANS_FAILURE_BIT      12     //!< [АНС-Д001] АНС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_ANS_TRUE_HEADING_BIT 13     //!< [АНС-Л001] МФИ КУРС ИСТИННЫЙ ОТ АНС (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_44_DISS_FAILURE_BIT     14     //!< [ДИСС] ДИСС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_DISS_MEMORY_BIT      15     //!< [ДИСС-Д001] ДИСС ПАМЯТЬ (СОСТ)
+#define MFCI_SIGNALS_WORD_44_MASK                 0xffff //!< Маска признаков слова 44 сигнализации МФЦИ
+
+//! Признаки слова 45 сигнализации МФЦИ (mfci_signals_word_45_b_t)
+#define MFCI_SIGNALS_WORD_45_ARK_FAILURE_BIT                  0      //!< [АРК-Д001]  АРК ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_SEV_FAILURE_BIT                  1      //!< [СЕВ-Д001]  СЕВ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_ABD_FAILURE_BIT                  2      //!< [АБД-Д001]  АБД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_BASK_FAILURE_BIT                 3      //!< [БАСК-Д001] БАСК ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_RLS_FAILURE_BIT                  4      //!< [РЛС-Д001]  РЛС ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_45_MSRP_ZBN1_FAILURE_BIT            5      //!< [МСРП-Д001] МСРП ЗБН1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_MSRP_ZBN2_FAILURE_BIT            6      //!< [МСРП-Д002] МСРП ЗБН2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_MSRP_BSPI_FAILURE_BIT            7      //!< [МСРП-Д003] МСРП БСПИ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_MSRP_PUSN_FAILURE_BIT            8      //!< [МСРП-Д004] МСРП ПУ СН ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_SVR_FAILURE_BIT                  9      //!< [СВР-Д001]  СВР ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_KVR_FAILURE_BIT                  10     //!< [КВР] КВР ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_45_FRONT_SHIELD_HEATING_FAILURE_BIT 11     //!< [ОБОГ-Д001] СТЕКЛО ЛОБОВОЕ ОТКАЗ ОБОГРЕВ ОТКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_45_RIGHT_SHIELD_HEATING_FAILURE_BIT 12     //!< [ОБОГ-Д002] СТЕКЛО ПРАВОЕ ОТКАЗ ОБОГРЕВ ОТКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_45_LEFT_SHIELD_HEATING_FAILURE_BIT  13     //!< [ОБОГ-Д003] СТЕКЛО ЛЕВОЕ ОТКАЗ ОБОГРЕВ ОТКЛЮЧИ (ДВ/С)
+#define MFCI_SIGNALS_WORD_45_RAFT_FAILURE_BIT                 14     //!< [ПЛОТ-Д001] ПЛОТ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_45_RADIATION_BIT                    15     //!< [РАД-Д001] РАДИАЦИЯ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_45_MASK                             0xffff //!< Маска признаков слова 45 сигнализации МФЦИ
+
+//! Признаки слова 46 сигнализации МФЦИ (mfci_signals_word_46_b_t)
+#define MFCI_SIGNALS_WORD_46_BIS_KANS_FAILURE_BIT         0      //!< [ИУС-Л001] БИС КЭНС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UBVR_EMS_FAILURE_BIT         1      //!< [УБВР-Д019] УБВР ОБЕСПЕЧЕНИЕ ЭМС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS1_FAILURE_BIT             2      //!< [УКС-Д003] КОНЦЕНТРАТОР СИГНАЛОВ 1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS2_FAILURE_BIT             3      //!< [УКС-Д004] КОНЦЕНТРАТОР СИГНАЛОВ 2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS3_FAILURE_BIT             4      //!< [УКС-Д005] КОНЦЕНТРАТОР СИГНАЛОВ 3 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS4_FAILURE_BIT             5      //!< [УКС-Д006] КОНЦЕНТРАТОР СИГНАЛОВ 4 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS_ANALOG_FAILURE_BIT       6      //!< [УКС-Д007] КОНЦЕНТРАТОР АНАЛОГ СИГНАЛОВ ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS_RK_FAILURE_BIT           7      //!< [УКС-Д008] КОНЦЕНТРАТОР РАЗОВЫХ КОМАНД ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_46_UKS_UNRESERVED_BIT           8      //!< [УКС-Д009] КОНЦЕНТРАТОР СИГНАЛОВ РЕЗЕРВА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_46_UKS_PARAMETRIC_FAILURE_BIT   9      //!< [УКС-Д010] КОНЦЕНТРАТОР СИГНАЛОВ ИНФОРМ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_46_UKS_TAR_AVAILABLE_BIT        10     //!< [ТАР] Доступность тарировки УКС
+#define MFCI_SIGNALS_WORD_46_FRONT_BOOST_PRESSURE_LOW_BIT 11     //!< [НАД-Д001] НАДДУВ БЛОКОВ ДАВЛ МАЛО ПЕРЕДН (СОСТ)
+#define MFCI_SIGNALS_WORD_46_REAR_BOOST_PRESSURE_LOW_BIT  12     //!< [НАД-Д002] НАДДУВ БЛОКОВ ДАВЛ МАЛО ЗАДН (СОСТ)
+#define MFCI_SIGNALS_WORD_46_CHUTE_FAILURE_BIT            13     //!< [ПРШТ-Д001] ПАРАШЮТ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_46_CHUTE_CUT_BIT                14     //!< [ПРШТ-Д002] ПАРАШЮТ СБРОШЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_46_CHUTE_DRAGGED_BIT            15     //!< [ПРШТ-Д003] ПАРАШЮТ ВЫПУЩЕН (ДВ/С)
+#define MFCI_SIGNALS_WORD_46_MASK                         0xffff //!< Маска признаков слова 46 сигнализации МФЦИ
+
+//! Признаки слова 47 сигнализации МФЦИ (mfci_signals_word_47_b_t)
+#define MFCI_SIGNALS_WORD_47_DV1_FIRE_BIT             0      //!< [СПЗ-Л005] ДВ1 ПОЖАР (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_47_DV1_OVERHEATING_BIT      1      //!< [СПЗ-Л001] ДВ1 ПЕРЕГРЕВ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_47_DV1_RUD_LOW_DOWN_BIT     2      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, УСТАНОВИ РУД ДВ1 НА МГ (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_CLOSE_STOP_VALVE_BIT 3      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ СТОП-КРАН ДВ1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_CLOSE_FIRE_COCK_BIT  4      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ ПК1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_PRESS_DVIG_BIT       5      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ДВИГ1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_PRESS_STRIKE_1_BIT   6      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_PRESS_STRIKE_2_BIT   7      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_PRESS_STRIKE_3_BIT   8      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_TURN_OFF_GEN_1_BIT   9      //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_TURN_OFF_GEN_2_BIT   10     //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 1 (СИГН)
+#define MFCI_SIGNALS_WORD_47_DV1_TURN_OFF_BLEED_1_BIT 11     //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_DV1_TURN_OFF_BLEED_2_BIT 12     //!< [СПЗ] ДВ1 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ1 (СИГН)
+#define MFCI_SIGNALS_WORD_47_DV2_FIRE_BIT             13     //!< [СПЗ-Л006] ДВ2 ПОЖАР (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_47_DV2_OVERHEATING_BIT      14     //!< [СПЗ-Л002] ДВ2 ПЕРЕГРЕВ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_47_DV2_RUD_LOW_DOWN_BIT     15     //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, УСТАНОВИ РУД ДВ2 НА МГ (ДВ/С)
+#define MFCI_SIGNALS_WORD_47_MASK                     0xffff //!< Маска признаков слова 47 сигнализации МФЦИ
+
+//! Признаки слова 48 сигнализации МФЦИ (mfci_signals_word_48_b_t)
+#define MFCI_SIGNALS_WORD_48_DV2_CLOSE_STOP_VALVE_BIT 0      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ СТОП-КРАН ДВ2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_CLOSE_FIRE_COCK_BIT  1      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ ПК2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_PRESS_DVIG_BIT       2      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ДВИГ2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_PRESS_STRIKE_1_BIT   3      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_PRESS_STRIKE_2_BIT   4      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_PRESS_STRIKE_3_BIT   5      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_TURN_OFF_GEN_1_BIT   6      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_TURN_OFF_GEN_2_BIT   7      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 2 (СИГН)
+#define MFCI_SIGNALS_WORD_48_DV2_TURN_OFF_BLEED_1_BIT 8      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV2_TURN_OFF_BLEED_2_BIT 9      //!< [СПЗ] ДВ2 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ2 (СИГН)
+#define MFCI_SIGNALS_WORD_48_DV3_FIRE_BIT             10     //!< [СПЗ-Л007] ДВ3 ПОЖАР (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_48_DV3_OVERHEATING_BIT      11     //!< [СПЗ-Л003] ДВ3 ПЕРЕГРЕВ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_48_DV3_RUD_LOW_DOWN_BIT     12     //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, УСТАНОВИ РУД ДВ3 НА МГ (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV3_CLOSE_STOP_VALVE_BIT 13     //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ СТОП-КРАН ДВ3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV3_CLOSE_FIRE_COCK_BIT  14     //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ ПК3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_DV3_PRESS_DVIG_BIT       15     //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ДВИГ3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_48_MASK                     0xffff //!< Маска признаков слова 48 сигнализации МФЦИ
+
+//! Признаки слова 49 сигнализации МФЦИ (mfci_signals_word_49_b_t)
+#define MFCI_SIGNALS_WORD_49_DV3_PRESS_STRIKE_1_BIT   0      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV3_PRESS_STRIKE_2_BIT   1      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV3_PRESS_STRIKE_3_BIT   2      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV3_TURN_OFF_GEN_1_BIT   3      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV3_TURN_OFF_GEN_2_BIT   4      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 3 (СИГН)
+#define MFCI_SIGNALS_WORD_49_DV3_TURN_OFF_BLEED_1_BIT 5      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV3_TURN_OFF_BLEED_2_BIT 6      //!< [СПЗ] ДВ3 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ3 (СИГН)
+#define MFCI_SIGNALS_WORD_49_DV4_FIRE_BIT             7      //!< [СПЗ-Л008] ДВ4 ПОЖАР (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_49_DV4_OVERHEATING_BIT      8      //!< [СПЗ-Л004] ДВ4 ПЕРЕГРЕВ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_49_DV4_RUD_LOW_DOWN_BIT     9      //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, УСТАНОВИ РУД ДВ4 НА МГ (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV4_CLOSE_STOP_VALVE_BIT 10     //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ СТОП-КРАН ДВ4 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV4_CLOSE_FIRE_COCK_BIT  11     //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, ЗАКРОЙ ПК4 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV4_PRESS_DVIG_BIT       12     //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ДВИГ4 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV4_PRESS_STRIKE_1_BIT   13     //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 1 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV4_PRESS_STRIKE_2_BIT   14     //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 2 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_DV4_PRESS_STRIKE_3_BIT   15     //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, НАЖМИ ОЧЕРЕДЬ 3 (ДВ/С)
+#define MFCI_SIGNALS_WORD_49_MASK                     0xffff //!< Маска признаков слова 49 сигнализации МФЦИ
+
+//! Признаки слова 50 сигнализации МФЦИ (mfci_signals_word_50_b_t)
+#define MFCI_SIGNALS_WORD_50_DV4_TURN_OFF_GEN_1_BIT   0      //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 4 (ДВ/С)
+#define MFCI_SIGNALS_WORD_50_DV4_TURN_OFF_GEN_2_BIT   1      //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ГЕНЕРАТОРЫ 4 (СИГН)
+#define MFCI_SIGNALS_WORD_50_DV4_TURN_OFF_BLEED_1_BIT 2      //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ4 (ДВ/С)
+#define MFCI_SIGNALS_WORD_50_DV4_TURN_OFF_BLEED_2_BIT 3      //!< [СПЗ] ДВ4 ПОЖАР/ПЕРЕГРЕВ, ОТКЛЮЧИ ОТБОР ОТ ДВ4 (СИГН)
+#define MFCI_SIGNALS_WORD_50_VSU_FIRE_BIT             4      //!< [СПЗ-Л009] ВСУ ПОЖАР (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_50_VSU_PRESS_STOP_BIT       5      //!< [СПЗ] ВСУ ПОЖАР, НАЖМИ ОСТАНОВ ВСУ (СИГН)
+#define MFCI_SIGNALS_WORD_50_VSU_TURN_OFF_GEN_BIT     6      //!< [СПЗ] ВСУ ПОЖАР, ОТКЛЮЧИ ГЕНЕРАТОР ВСУ (СИГН)
+#define MFCI_SIGNALS_WORD_50_VSU_PRESS_STRIKE_1_BIT   7      //!< [СПЗ] ВСУ ПОЖАР, НАЖМИ ОЧЕРЕДЬ 1 (СИГН)
+#define MFCI_SIGNALS_WORD_50_VSU_PRESS_STRIKE_2_BIT   8      //!< [СПЗ] ВСУ ПОЖАР, НАЖМИ ОЧЕРЕДЬ 2 (СИГН)
+#define MFCI_SIGNALS_WORD_50_VSU_PRESS_STRIKE_3_BIT   9      //!< [СПЗ] ВСУ ПОЖАР, НАЖМИ ОЧЕРЕДЬ 3 (СИГН)
+#define MFCI_SIGNALS_WORD_50_BCVM_SEL_COURSE_BIT      10     //!< [БЦВМ-Д006] ЗК РУЧН (ПЛАН)
+#define MFCI_SIGNALS_WORD_50_BCVM_TO_POINT_BIT        11     //!< [БЦВМ-Д011] ПРЯМО НА (ПЛАН)
+#define MFCI_SIGNALS_WORD_50_BCVM_ROUTE_SHIFT_BIT     12     //!< [БЦВМ-Д012] СМЕЩ МАРШ (ПЛАН)
+#define MFCI_SIGNALS_WORD_50_BCVM_ORBIT_LEFT_BIT      13     //!< [БЦВМ-Д013] ОРБИТА ЛЕВ (ПЛАН)
+#define MFCI_SIGNALS_WORD_50_BCVM_ORBIT_RIGHT_BIT     14     //!< [БЦВМ-Д014] ОРБИТА ПРАВ (ПЛАН)
+#define MFCI_SIGNALS_WORD_50_BCVM_WAITING_ZONE_BIT    15     //!< [БЦВМ-Д015] ЗОНА ОЖ (ПЛАН)
+#define MFCI_SIGNALS_WORD_50_MASK                     0xffff //!< Маска признаков слова 50 сигнализации МФЦИ
+
+//! Признаки слова 51 сигнализации МФЦИ (mfci_signals_word_51_b_t)
+#define MFCI_SIGNALS_WORD_51_BCVM_REVERSE_ROUTE_BIT     0      //!< [БЦВМ-Д023] РЕВЕРС МАРШ (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_TEARDROP_BIT          1      //!< [БЦВМ-Д029] ОТВОРОТ НА РУ (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_AZIMUTH_TO_RSBN_BIT   2      //!< [БЦВМ-Д031] АЗИМУТ НА РСБН (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_AZIMUTH_FROM_RSBN_BIT 3      //!< [БЦВМ-Д032] АЗИМУТ ОТ РСБН (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_AZIMUTH_TO_VOR1_BIT   4      //!< [БЦВМ-Д033] АЗИМУТ НА VOR1 (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_AZIMUTH_FROM_VOR1_BIT 5      //!< [БЦВМ-Д034] АЗИМУТ ОТ VOR1 (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_AZIMUTH_TO_VOR2_BIT   6      //!< [БЦВМ-Д035] АЗИМУТ НА VOR2 (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_AZIMUTH_FROM_VOR2_BIT 7      //!< [БЦВМ-Д036] АЗИМУТ ОТ VOR2 (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_SEL_TRACK_ANGLE_BIT   8      //!< [БЦВМ-Д037] ЗПУ РУЧН (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_SEL_TIME_MANEUVER_BIT 9      //!< [БЦВМ-Д038] ВЫХ Тзад (ПОГАШЕНИЕ dt, ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_SEL_ROLL_RIGHT_BIT    10     //!< [БЦВМ-Д039] ВИРАЖ ПРАВ (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_TURN_BIT              11     //!< [БЦВМ-Д040] СТАНД РАЗВ (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_INVERTED_TURN_BIT     12     //!< [БЦВМ-Д041] ОБР СТАНД РАЗВ (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_TACKING_BIT           13     //!< [БЦВМ-Д042] ГАЛСИРОВАНИЕ (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_SHUTTLE_BIT           14     //!< [БЦВМ-Д043] ЧЕЛНОК (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_BCVM_LANDING_PATTERN_BIT   15     //!< [БЦВМ-Д044] БК (ПЛАН)
+#define MFCI_SIGNALS_WORD_51_MASK                       0xffff //!< Маска признаков слова 51 сигнализации МФЦИ
+
+//! Признаки слова 52 сигнализации МФЦИ (mfci_signals_word_52_b_t)
+#define MFCI_SIGNALS_WORD_52_BCVM_SEL_ROLL_LEFT_BIT   0      //!< [БЦВМ-Д045] ВИРАЖ ЛЕВ (ПЛАН)
+#define MFCI_SIGNALS_WORD_52_BCVM_TAKEOFF_RUD_65_BIT  1      //!< [БЦВМ-Д050] ВЗЛЕТ АЛЬФА РУД = 65 (ДВ/С)
+#define MFCI_SIGNALS_WORD_52_BCVM_TAKEOFF_RUD_72_BIT  2      //!< [БЦВМ-Д051] ВЗЛЕТ АЛЬФА РУД = 72 (ДВ/С)
+#define MFCI_SIGNALS_WORD_52_BCVM_TAKEOFF_RUD_85_BIT  3      //!< [БЦВМ-Д052] ВЗЛЕТ АЛЬФА РУД = 85 (ДВ/С)
+#define MFCI_SIGNALS_WORD_52_BCVM_TAKEOFF_RUD_95_BIT  4      //!< [БЦВМ-Д053] ВЗЛЕТ АЛЬФА РУД = 95 (ДВ/С)
+#define MFCI_SIGNALS_WORD_52_BCVM_TAKEOFF_RUD_115_BIT 5      //!< [БЦВМ-Д054] ВЗЛЕТ АЛЬФА РУД = 115 (ДВ/С)
+#define MFCI_SIGNALS_WORD_52_BVD_COMPARE_PBD_BIT      6      //!< [БВД] ПБД СРАВНИ (СОСТ)
+#define MFCI_SIGNALS_WORD_52_BVD_COMPARE_ND1_BIT      7      //!< [БВД] НД1 СРАВНИ (СОСТ)
+#define MFCI_SIGNALS_WORD_52_BVD_COMPARE_ND2_BIT      8      //!< [БВД] НД2 СРАВНИ (СОСТ)
+#define MFCI_SIGNALS_WORD_52_BVD_COMPARE_ND3_BIT      9      //!< [БВД] НД3 СРАВНИ (СОСТ)
+#define MFCI_SIGNALS_WORD_52_BVD_COMPARE_ND4_BIT      10     //!< [БВД] НД4 СРАВНИ (СОСТ)
+#define MFCI_SIGNALS_WORD_52_BGS1_FAILURE_BIT         11     //!< [МФИ] Отказ БГС1
+#define MFCI_SIGNALS_WORD_52_BGS2_FAILURE_BIT         12     //!< [МФИ] Отказ БГС2
+#define MFCI_SIGNALS_WORD_52_MASK                     0x1fff //!< Маска признаков слова 52 сигнализации МФЦИ
+
+//! Признаки слова 53 сигнализации МФЦИ (mfci_signals_word_53_b_t)
+#define MFCI_SIGNALS_WORD_53_TANKS_PRESSURE_LOW_BIT         0      //!< [НГ-Д001] РАЗРЕЖЕН БАКОВ ВЕЛИКО (ДВ/С)
+#define MFCI_SIGNALS_WORD_53_PRESSURIZATION_HIGH_BIT        1      //!< [НГ-Д002] НАДДУВ БАКОВ ВЕЛИК (ДВ/С)
+#define MFCI_SIGNALS_WORD_53_PRESSURIZATION_LOW_BIT         2      //!< [НГ-Д003] НАДДУВ БАКОВ МАЛ (ДВ/С)
+#define MFCI_SIGNALS_WORD_53_PRESSURIZATION_FAILURE_BIT     3      //!< [НГ-Д004] НАДДУВ БАКОВ ОТКАЗ (ДВ/С)
+#define MFCI_SIGNALS_WORD_53_NITROGEN_LOW_BIT               4      //!< [НГ-Д005] ТОПЛ АЗОТА НЕТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_53_SNS_FAILURE_BIT                5      //!< [СНС-Л002] ПНАП ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_53_SNS_GLNS_FAILURE_BIT           6      //!< [СНС-Л003] ПНАП ГЛНС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_53_SNS_SRNS_FAILURE_BIT           7      //!< [СНС-Л004] ПНАП СРНС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_53_SNS_IFRNS_FAILURE_BIT          8      //!< [СНС-Л005] ПНАП ИФРНС ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_53_STEERING_NO_CONROL_BIT         9      //!< [СУПК-Л001] ПОВОРОТ КОЛЕС САМООРИЕНТ (ДВ/С)
+#define MFCI_SIGNALS_WORD_53_TAXING_BIT                     10     //!< [СУПК-Л002] КОЛЕСА РУЛЕНИЕ (ДВ/С, НЕ ГОТОВ К ВЗЛЁТУ)
+#define MFCI_SIGNALS_WORD_53_STEERING_CHANNEL_1_FAILURE_BIT 11     //!< [СУПК-Л003] ПОВОРОТ КОЛЕС КАНАЛ 1 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_53_STEERING_CHANNEL_2_FAILURE_BIT 12     //!< [СУПК-Л004] ПОВОРОТ КОЛЕС КАНАЛ 2 ОТКАЗ (СОСТ)
+#define MFCI_SIGNALS_WORD_53_MASK                           0x1fff //!< Маска признаков слова 53 сигнализации МФЦИ
+
+//! Признаки слова 54 сигнализации МФЦИ (mfci_signals_word_54_b_t)
+#define MFCI_SIGNALS_WORD_54_IUS_SOUND_FAILURE_BIT         0      //!< [СОИ-Л004] ИУС ЗВУК СИГН ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_54_IUS_CSO_FAILURE_BIT           1      //!< [СОИ-Л005] ИУС ЦСО ОТКАЗ (ДВ/С, СИГН)
+#define MFCI_SIGNALS_WORD_54_IUS_SOUND_RESERVE_FAILURE_BIT 2      //!< [СОИ-Л006] ИУС ИУС ЗВУК СИГН РЕЗЕРВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_54_IUS_CSO_RESERVE_FAILURE_BIT   3      //!< [СОИ-Л007] ИУС ИУС ЦСО РЕЗЕРВА НЕТ (СОСТ)
+#define MFCI_SIGNALS_WORD_54_SAS_FAILURE_PILOT_1_BIT       4      //!< [САС-Л001] САС КОМАНДИРА СИГН НЕДОСТОВЕРНА (СОСТ)
+#define MFCI_SIGNALS_WORD_54_SAS_FAILURE_PILOT_2_BIT       5      //!< [САС-Л002] САС ПОМОЩНИКА СИГН НЕДОСТОВЕРНА (СОСТ)
+#define MFCI_SIGNALS_WORD_54_SAS_FAILURE_OPERATOR_BIT      6      //!< [САС-Л003] САС ОПЕРАТОРА СИГН НЕДОСТОВЕРНА (СОСТ)
+#define MFCI_SIGNALS_WORD_54_SAS_FAILURE_NAVIGATOR_BIT     7      //!< [САС-Д009] САС ШТУРМАНА СИГН НЕДОСТОВЕРНА (СОСТ)
+#define MFCI_SIGNALS_WORD_54_SAS_CLEAR_PILOT_1_BIT         8      //!< [САС] Отбой ЦСО № 1 КК (ЦСО летчика 1 нажата)
+#define MFCI_SIGNALS_WORD_54_SAS_CLEAR_PILOT_2_BIT         9      //!< [САС] Отбой ЦСО № 2 ПКК (ЦСО летчика 2 нажата)
+#define MFCI_SIGNALS_WORD_54_SAS_CLEAR_OPERATOR_BIT        10     //!< [САС] Отбой ЦСО № 3 ШО (ЦСО штурмана-оператора нажата)
+#define MFCI_SIGNALS_WORD_54_SAS_CLEAR_NAVIGATOR_BIT       11     //!< [САС] Отбой ЦСО № 4 ШК (ЦСО штурмана-навигатора нажата)
+#define MFCI_SIGNALS_WORD_54_MASK                          0x0fff //!< Маска признаков слова 54 сигнализации МФЦИ
+
 //! Слово 1 сигналов 19-ДА
 typedef struct u19_flag_word_1_b_t {
    uint16_t healthy           : 1; //!< Наличие достоверных данных от 19-ДА